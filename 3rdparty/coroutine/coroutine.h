@@ -65,12 +65,14 @@ enum class ResumeResult
 struct Routine
 {
     std::function<void()> func;
+    size_t stack_size;
     bool finished;
     LPVOID fiber;
 
-    Routine(std::function<void()> f)
+    Routine(std::function<void()> f, size_t ss = 0)
     {
         func = f;
+        stack_size = ss;
         finished = false;
         fiber = nullptr;
     }
@@ -105,9 +107,10 @@ struct Ordinator
 
 thread_local static Ordinator ordinator;
 
-inline routine_t create(std::function<void()> f)
+// Fibers always allocate their own stack: only its size is used.
+inline routine_t create(std::function<void()> f, char* /*stack*/, size_t stack_size)
 {
-    Routine* routine = new Routine(f);
+    Routine* routine = new Routine(f, stack_size);
 
     if (ordinator.indexes.empty())
     {
@@ -124,6 +127,11 @@ inline routine_t create(std::function<void()> f)
     }
 }
 
+inline routine_t create(std::function<void()> f)
+{
+    return create(f, nullptr, 0);
+}
+
 inline void destroy(routine_t id)
 {
     Routine* routine = ordinator.routines[id - 1];
@@ -161,7 +169,8 @@ inline ResumeResult resume(routine_t id)
 
     if (routine->fiber == nullptr)
     {
-        routine->fiber = CreateFiber(ordinator.stack_size, entry, 0);
+        routine->fiber = CreateFiber(routine->stack_size ? routine->stack_size : ordinator.stack_size,
+                                     entry, 0);
         ordinator.current = id;
         SwitchToFiber(routine->fiber);
     }
@@ -235,19 +244,27 @@ struct Routine
 {
     std::function<void()> func;
     char* stack;
+    size_t stack_size;
+    // false if the stack was given to create()
+    bool owns_stack;
+    bool started;
     bool finished;
     ucontext_t ctx;
 
-    Routine(std::function<void()> f)
+    Routine(std::function<void()> f, char* s = nullptr, size_t ss = 0)
     {
         func = f;
-        stack = nullptr;
+        stack = s;
+        stack_size = ss;
+        owns_stack = (s == nullptr);
+        started = false;
         finished = false;
     }
 
     ~Routine()
     {
-        delete[] stack;
+        if (owns_stack)
+            delete[] stack;
     }
 };
 
@@ -274,9 +291,11 @@ struct Ordinator
 
 thread_local static Ordinator ordinator;
 
-inline routine_t create(std::function<void()> f)
+// If stack is not null, the routine runs on it, and the caller frees it after
+// destroy(). Otherwise a stack of ordinator.stack_size is allocated.
+inline routine_t create(std::function<void()> f, char* stack, size_t stack_size)
 {
-    Routine* routine = new Routine(f);
+    Routine* routine = new Routine(f, stack, stack_size);
 
     if (ordinator.indexes.empty())
     {
@@ -293,11 +312,20 @@ inline routine_t create(std::function<void()> f)
     }
 }
 
+inline routine_t create(std::function<void()> f)
+{
+    return create(f, nullptr, 0);
+}
+
 inline void destroy(routine_t id)
 {
     Routine* routine = ordinator.routines[id - 1];
     assert(routine != nullptr);
 
+    // entry() recycles the id of the finished routines only
+    if (!routine->finished)
+        ordinator.indexes.push_back(id);
+
     delete routine;
     ordinator.routines[id - 1] = nullptr;
 }
@@ -324,8 +352,9 @@ inline ResumeResult resume(routine_t id)
     if (routine->finished)
         return ResumeResult::FINISHED;
 
-    if (routine->stack == nullptr)
+    if (!routine->started)
     {
+        routine->started = true;
         //initializes the structure to the currently active context.
         //When successful, getcontext() returns 0
         //On error, return -1 and set errno appropriately.
@@ -334,9 +363,13 @@ inline ResumeResult resume(routine_t id)
         //Before invoking makecontext(), the caller must allocate a new stack
         //for this context and assign its address to ucp->uc_stack,
         //and define a successor context and assign its address to ucp->uc_link.
-        routine->stack = new char[ordinator.stack_size];
+        if (routine->stack == nullptr)
+        {
+            routine->stack = new char[ordinator.stack_size];
+            routine->stack_size = ordinator.stack_size;
+        }
         routine->ctx.uc_stack.ss_sp = routine->stack;
-        routine->ctx.uc_stack.ss_size = ordinator.stack_size;
+        routine->ctx.uc_stack.ss_size = routine->stack_size;
         routine->ctx.uc_link = &ordinator.ctx;
         ordinator.current = id;
 
@@ -364,9 +397,9 @@ inline void yield()
     Routine* routine = ordinator.routines[id - 1];
     assert(routine != nullptr);
 
-    char* stack_top = routine->stack + ordinator.stack_size;
+    char* stack_top = routine->stack + routine->stack_size;
     char stack_bottom = 0;
-    assert(size_t(stack_top - &stack_bottom) <= ordinator.stack_size);
+    assert(size_t(stack_top - &stack_bottom) <= routine->stack_size);
 
     ordinator.current = 0;
     swapcontext(&routine->ctx, &ordinator.ctx);
@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Debug".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "BehaviorTree::behaviortree_cpp_v3" for configuration "Debug"
+set_property(TARGET BehaviorTree::behaviortree_cpp_v3 APPEND PROPERTY IMPORTED_CONFIGURATIONS DEBUG)
+set_target_properties(BehaviorTree::behaviortree_cpp_v3 PROPERTIES
+  IMPORTED_LOCATION_DEBUG "${_IMPORT_PREFIX}/lib/libbehaviortree_cpp_v3.so"
+  IMPORTED_SONAME_DEBUG "libbehaviortree_cpp_v3.so"
+  )
+
+list(APPEND _cmake_import_check_targets BehaviorTree::behaviortree_cpp_v3 )
+list(APPEND _cmake_import_check_files_for_BehaviorTree::behaviortree_cpp_v3 "${_IMPORT_PREFIX}/lib/libbehaviortree_cpp_v3.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,50 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/minitrace/minitrace.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/3rdparty/minitrace/minitrace.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/3rdparty/minitrace/minitrace.cpp.o.d"
+  "/root/repo/src/action_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/action_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/action_node.cpp.o.d"
+  "/root/repo/src/basic_types.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/basic_types.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/basic_types.cpp.o.d"
+  "/root/repo/src/behavior_tree.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/behavior_tree.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/behavior_tree.cpp.o.d"
+  "/root/repo/src/blackboard.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/blackboard.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/blackboard.cpp.o.d"
+  "/root/repo/src/blueprint_serialization.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/blueprint_serialization.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/blueprint_serialization.cpp.o.d"
+  "/root/repo/src/bt_factory.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/bt_factory.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/bt_factory.cpp.o.d"
+  "/root/repo/src/condition_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/condition_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/condition_node.cpp.o.d"
+  "/root/repo/src/control_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/control_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/control_node.cpp.o.d"
+  "/root/repo/src/controls/fallback_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/fallback_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/fallback_node.cpp.o.d"
+  "/root/repo/src/controls/parallel_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/parallel_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/parallel_node.cpp.o.d"
+  "/root/repo/src/controls/reactive_fallback.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_fallback.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_fallback.cpp.o.d"
+  "/root/repo/src/controls/reactive_sequence.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_sequence.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_sequence.cpp.o.d"
+  "/root/repo/src/controls/sequence_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_node.cpp.o.d"
+  "/root/repo/src/controls/sequence_star_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_star_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_star_node.cpp.o.d"
+  "/root/repo/src/coroutine_stack_pool.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/coroutine_stack_pool.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/coroutine_stack_pool.cpp.o.d"
+  "/root/repo/src/decorator_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorator_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorator_node.cpp.o.d"
+  "/root/repo/src/decorators/inverter_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/inverter_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/inverter_node.cpp.o.d"
+  "/root/repo/src/decorators/repeat_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/repeat_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/repeat_node.cpp.o.d"
+  "/root/repo/src/decorators/retry_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/retry_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/retry_node.cpp.o.d"
+  "/root/repo/src/decorators/subtree_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/subtree_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/subtree_node.cpp.o.d"
+  "/root/repo/src/decorators/timeout_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/timeout_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/timeout_node.cpp.o.d"
+  "/root/repo/src/loggers/bt_cout_logger.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_cout_logger.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_cout_logger.cpp.o.d"
+  "/root/repo/src/loggers/bt_file_logger.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_file_logger.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_file_logger.cpp.o.d"
+  "/root/repo/src/loggers/bt_minitrace_logger.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_minitrace_logger.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_minitrace_logger.cpp.o.d"
+  "/root/repo/src/private/tinyxml2.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/private/tinyxml2.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/private/tinyxml2.cpp.o.d"
+  "/root/repo/src/shared_library.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library.cpp.o.d"
+  "/root/repo/src/shared_library_UNIX.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library_UNIX.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library_UNIX.cpp.o.d"
+  "/root/repo/src/thread_pool.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/thread_pool.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/thread_pool.cpp.o.d"
+  "/root/repo/src/timer_service.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/timer_service.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/timer_service.cpp.o.d"
+  "/root/repo/src/tree_node.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/tree_node.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/tree_node.cpp.o.d"
+  "/root/repo/src/xml_parsing.cpp" "CMakeFiles/behaviortree_cpp_v3.dir/src/xml_parsing.cpp.o" "gcc" "CMakeFiles/behaviortree_cpp_v3.dir/src/xml_parsing.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/behaviortree_cpp_v3.dir/3rdparty/minitrace/minitrace.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/3rdparty/minitrace/minitrace.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/action_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/action_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/basic_types.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/basic_types.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/behavior_tree.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/behavior_tree.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/blackboard.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/blackboard.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/blueprint_serialization.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/blueprint_serialization.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/bt_factory.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/bt_factory.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/condition_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/condition_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/control_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/control_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/fallback_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/fallback_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/parallel_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/parallel_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_fallback.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_fallback.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_sequence.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/reactive_sequence.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_star_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/controls/sequence_star_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/coroutine_stack_pool.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/coroutine_stack_pool.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorator_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorator_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/inverter_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/inverter_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/repeat_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/repeat_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/retry_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/retry_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/subtree_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/subtree_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/timeout_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/decorators/timeout_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_cout_logger.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_cout_logger.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_file_logger.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_file_logger.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_minitrace_logger.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/loggers/bt_minitrace_logger.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/private/tinyxml2.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/private/tinyxml2.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library_UNIX.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/shared_library_UNIX.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/thread_pool.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/thread_pool.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/timer_service.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/timer_service.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/tree_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/tree_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/xml_parsing.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3.dir/src/xml_parsing.cpp.o.d"
+  "lib/libbehaviortree_cpp_v3.pdb"
+  "lib/libbehaviortree_cpp_v3.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/behaviortree_cpp_v3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
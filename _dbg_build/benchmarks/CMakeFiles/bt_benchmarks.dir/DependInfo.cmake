@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/any_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/any_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/any_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/blackboard_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/blackboard_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/blackboard_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/convert_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/convert_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/convert_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/coroutine_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/coroutine_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/coroutine_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/ports_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/ports_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/ports_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/status_change_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/status_change_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/status_change_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/tick_loop_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/tick_loop_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/tick_loop_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/timer_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/timer_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/timer_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/tree_tick_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/tree_tick_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/tree_tick_benchmark.cpp.o.d"
+  "/root/repo/benchmarks/xml_load_benchmark.cpp" "benchmarks/CMakeFiles/bt_benchmarks.dir/xml_load_benchmark.cpp.o" "gcc" "benchmarks/CMakeFiles/bt_benchmarks.dir/xml_load_benchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/CMakeFiles/behaviortree_cpp_v3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
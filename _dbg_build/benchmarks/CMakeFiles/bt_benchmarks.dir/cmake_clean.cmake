@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "../bin/bt_benchmarks"
+  "../bin/bt_benchmarks.pdb"
+  "CMakeFiles/bt_benchmarks.dir/any_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/any_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/blackboard_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/blackboard_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/convert_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/convert_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/coroutine_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/coroutine_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/ports_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/ports_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/status_change_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/status_change_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/tick_loop_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/tick_loop_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/timer_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/timer_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/tree_tick_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/tree_tick_benchmark.cpp.o.d"
+  "CMakeFiles/bt_benchmarks.dir/xml_load_benchmark.cpp.o"
+  "CMakeFiles/bt_benchmarks.dir/xml_load_benchmark.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bt_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
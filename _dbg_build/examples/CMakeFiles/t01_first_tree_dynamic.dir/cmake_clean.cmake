@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t01_first_tree_dynamic"
+  "../bin/t01_first_tree_dynamic.pdb"
+  "CMakeFiles/t01_first_tree_dynamic.dir/t01_build_your_first_tree.cpp.o"
+  "CMakeFiles/t01_first_tree_dynamic.dir/t01_build_your_first_tree.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t01_first_tree_dynamic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t02_basic_ports"
+  "../bin/t02_basic_ports.pdb"
+  "CMakeFiles/t02_basic_ports.dir/t02_basic_ports.cpp.o"
+  "CMakeFiles/t02_basic_ports.dir/t02_basic_ports.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t02_basic_ports.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/t03_generic_ports.cpp" "examples/CMakeFiles/t03_generic_ports.dir/t03_generic_ports.cpp.o" "gcc" "examples/CMakeFiles/t03_generic_ports.dir/t03_generic_ports.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/sample_nodes/CMakeFiles/bt_sample_nodes.dir/DependInfo.cmake"
+  "/root/repo/_dbg_build/CMakeFiles/behaviortree_cpp_v3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
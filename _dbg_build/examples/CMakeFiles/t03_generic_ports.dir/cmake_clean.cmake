@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t03_generic_ports"
+  "../bin/t03_generic_ports.pdb"
+  "CMakeFiles/t03_generic_ports.dir/t03_generic_ports.cpp.o"
+  "CMakeFiles/t03_generic_ports.dir/t03_generic_ports.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t03_generic_ports.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
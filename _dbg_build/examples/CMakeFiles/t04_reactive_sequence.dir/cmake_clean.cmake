@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t04_reactive_sequence"
+  "../bin/t04_reactive_sequence.pdb"
+  "CMakeFiles/t04_reactive_sequence.dir/t04_reactive_sequence.cpp.o"
+  "CMakeFiles/t04_reactive_sequence.dir/t04_reactive_sequence.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t04_reactive_sequence.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
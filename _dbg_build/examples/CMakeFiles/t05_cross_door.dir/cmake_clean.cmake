@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t05_cross_door"
+  "../bin/t05_cross_door.pdb"
+  "CMakeFiles/t05_cross_door.dir/t05_crossdoor.cpp.o"
+  "CMakeFiles/t05_cross_door.dir/t05_crossdoor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t05_cross_door.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t06_subtree_port_remapping"
+  "../bin/t06_subtree_port_remapping.pdb"
+  "CMakeFiles/t06_subtree_port_remapping.dir/t06_subtree_port_remapping.cpp.o"
+  "CMakeFiles/t06_subtree_port_remapping.dir/t06_subtree_port_remapping.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t06_subtree_port_remapping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t07_wrap_legacy"
+  "../bin/t07_wrap_legacy.pdb"
+  "CMakeFiles/t07_wrap_legacy.dir/t07_wrap_legacy.cpp.o"
+  "CMakeFiles/t07_wrap_legacy.dir/t07_wrap_legacy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t07_wrap_legacy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t08_additional_node_args"
+  "../bin/t08_additional_node_args.pdb"
+  "CMakeFiles/t08_additional_node_args.dir/t08_additional_node_args.cpp.o"
+  "CMakeFiles/t08_additional_node_args.dir/t08_additional_node_args.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t08_additional_node_args.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t09_async_actions_coroutines"
+  "../bin/t09_async_actions_coroutines.pdb"
+  "CMakeFiles/t09_async_actions_coroutines.dir/t09_async_actions_coroutines.cpp.o"
+  "CMakeFiles/t09_async_actions_coroutines.dir/t09_async_actions_coroutines.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t09_async_actions_coroutines.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
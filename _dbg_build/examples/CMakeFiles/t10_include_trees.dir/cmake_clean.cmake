@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/t10_include_trees"
+  "../bin/t10_include_trees.pdb"
+  "CMakeFiles/t10_include_trees.dir/t10_include_trees.cpp.o"
+  "CMakeFiles/t10_include_trees.dir/t10_include_trees.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/t10_include_trees.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/sample_nodes/crossdoor_nodes.cpp" "sample_nodes/CMakeFiles/bt_sample_nodes.dir/crossdoor_nodes.cpp.o" "gcc" "sample_nodes/CMakeFiles/bt_sample_nodes.dir/crossdoor_nodes.cpp.o.d"
+  "/root/repo/sample_nodes/dummy_nodes.cpp" "sample_nodes/CMakeFiles/bt_sample_nodes.dir/dummy_nodes.cpp.o" "gcc" "sample_nodes/CMakeFiles/bt_sample_nodes.dir/dummy_nodes.cpp.o.d"
+  "/root/repo/sample_nodes/movebase_node.cpp" "sample_nodes/CMakeFiles/bt_sample_nodes.dir/movebase_node.cpp.o" "gcc" "sample_nodes/CMakeFiles/bt_sample_nodes.dir/movebase_node.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/CMakeFiles/behaviortree_cpp_v3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
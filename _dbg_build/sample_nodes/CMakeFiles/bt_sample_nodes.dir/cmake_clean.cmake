@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bt_sample_nodes.dir/crossdoor_nodes.cpp.o"
+  "CMakeFiles/bt_sample_nodes.dir/crossdoor_nodes.cpp.o.d"
+  "CMakeFiles/bt_sample_nodes.dir/dummy_nodes.cpp.o"
+  "CMakeFiles/bt_sample_nodes.dir/dummy_nodes.cpp.o.d"
+  "CMakeFiles/bt_sample_nodes.dir/movebase_node.cpp.o"
+  "CMakeFiles/bt_sample_nodes.dir/movebase_node.cpp.o.d"
+  "lib/libbt_sample_nodes.a"
+  "lib/libbt_sample_nodes.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bt_sample_nodes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
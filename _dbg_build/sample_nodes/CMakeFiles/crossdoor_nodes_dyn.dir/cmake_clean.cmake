@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/crossdoor_nodes_dyn.dir/crossdoor_nodes.cpp.o"
+  "CMakeFiles/crossdoor_nodes_dyn.dir/crossdoor_nodes.cpp.o.d"
+  "bin/libcrossdoor_nodes_dyn.pdb"
+  "bin/libcrossdoor_nodes_dyn.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/crossdoor_nodes_dyn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
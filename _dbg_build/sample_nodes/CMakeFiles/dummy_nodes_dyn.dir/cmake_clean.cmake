@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dummy_nodes_dyn.dir/dummy_nodes.cpp.o"
+  "CMakeFiles/dummy_nodes_dyn.dir/dummy_nodes.cpp.o.d"
+  "bin/libdummy_nodes_dyn.pdb"
+  "bin/libdummy_nodes_dyn.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dummy_nodes_dyn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
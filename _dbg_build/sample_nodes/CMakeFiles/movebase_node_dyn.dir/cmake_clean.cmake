@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/movebase_node_dyn.dir/movebase_node.cpp.o"
+  "CMakeFiles/movebase_node_dyn.dir/movebase_node.cpp.o.d"
+  "bin/libmovebase_node_dyn.pdb"
+  "bin/libmovebase_node_dyn.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/movebase_node_dyn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/gtest_blackboard.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_blackboard.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_blackboard.cpp.o.d"
+  "/root/repo/tests/gtest_coroutines.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_coroutines.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_coroutines.cpp.o.d"
+  "/root/repo/tests/gtest_decorator.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_decorator.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_decorator.cpp.o.d"
+  "/root/repo/tests/gtest_factory.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_factory.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_factory.cpp.o.d"
+  "/root/repo/tests/gtest_fallback.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_fallback.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_fallback.cpp.o.d"
+  "/root/repo/tests/gtest_parallel.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_parallel.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_parallel.cpp.o.d"
+  "/root/repo/tests/gtest_sequence.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_sequence.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_sequence.cpp.o.d"
+  "/root/repo/tests/gtest_subtree.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_subtree.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_subtree.cpp.o.d"
+  "/root/repo/tests/gtest_tree.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_tree.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_tree.cpp.o.d"
+  "/root/repo/tests/navigation_test.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/navigation_test.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/navigation_test.cpp.o.d"
+  "/root/repo/tests/src/action_test_node.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/src/action_test_node.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/src/action_test_node.cpp.o.d"
+  "/root/repo/tests/src/condition_test_node.cpp" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/src/condition_test_node.cpp.o" "gcc" "tests/CMakeFiles/behaviortree_cpp_v3_test.dir/src/condition_test_node.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/sample_nodes/CMakeFiles/bt_sample_nodes.dir/DependInfo.cmake"
+  "/root/repo/_dbg_build/CMakeFiles/behaviortree_cpp_v3.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "../bin/behaviortree_cpp_v3_test"
+  "../bin/behaviortree_cpp_v3_test.pdb"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_blackboard.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_blackboard.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_coroutines.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_coroutines.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_decorator.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_decorator.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_factory.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_factory.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_fallback.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_fallback.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_parallel.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_parallel.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_sequence.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_sequence.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_subtree.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_subtree.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_tree.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/gtest_tree.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/navigation_test.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/navigation_test.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/src/action_test_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/src/action_test_node.cpp.o.d"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/src/condition_test_node.cpp.o"
+  "CMakeFiles/behaviortree_cpp_v3_test.dir/src/condition_test_node.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/behaviortree_cpp_v3_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
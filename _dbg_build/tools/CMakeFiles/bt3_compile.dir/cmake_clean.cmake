@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/bt3_compile"
+  "../bin/bt3_compile.pdb"
+  "CMakeFiles/bt3_compile.dir/bt_compile.cpp.o"
+  "CMakeFiles/bt3_compile.dir/bt_compile.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bt3_compile.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
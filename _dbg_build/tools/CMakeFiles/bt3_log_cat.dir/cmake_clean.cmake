@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/bt3_log_cat"
+  "../bin/bt3_log_cat.pdb"
+  "CMakeFiles/bt3_log_cat.dir/bt_log_cat.cpp.o"
+  "CMakeFiles/bt3_log_cat.dir/bt_log_cat.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bt3_log_cat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/bt3_plugin_manifest"
+  "../bin/bt3_plugin_manifest.pdb"
+  "CMakeFiles/bt3_plugin_manifest.dir/bt_plugin_manifest.cpp.o"
+  "CMakeFiles/bt3_plugin_manifest.dir/bt_plugin_manifest.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bt3_plugin_manifest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
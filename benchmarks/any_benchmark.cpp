@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/basic_types.h"
+#include "legacy_any.hpp"
+
+using namespace BT;
+
+namespace
+{
+enum class Color
+{
+    RED,
+    GREEN,
+    BLUE
+};
+
+template <typename T>
+T sampleValue();
+
+template <> int sampleValue<int>() { return 42; }
+template <> double sampleValue<double>() { return 3.0; }
+template <> Color sampleValue<Color>() { return Color::GREEN; }
+template <> std::string sampleValue<std::string>() { return "hello"; }
+template <> std::vector<double> sampleValue<std::vector<double>>() { return std::vector<double>(16, 1.0); }
+
+// AnyT is either Any or LegacyAny, the previous implementation
+template <typename AnyT, typename From, typename To>
+void BM_AnyCast(benchmark::State& state)
+{
+    const AnyT any(sampleValue<From>());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(any.template cast<To>());
+    }
+}
+
+template <typename AnyT>
+void BM_AnyConstruct(benchmark::State& state)
+{
+    int value = 0;
+    for (auto _ : state)
+    {
+        AnyT any(value++);
+        benchmark::DoNotOptimize(any);
+    }
+}
+
+template <typename AnyT>
+void BM_AnyCopy(benchmark::State& state)
+{
+    const AnyT any(sampleValue<double>());
+    for (auto _ : state)
+    {
+        AnyT copy(any);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+}
+
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, int, int);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, int, unsigned);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, int, double);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, double, double);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, double, int);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, Color, Color);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, std::string, std::string);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, int, std::string);
+BENCHMARK_TEMPLATE(BM_AnyCast, Any, std::vector<double>, std::vector<double>);
+BENCHMARK_TEMPLATE(BM_AnyConstruct, Any);
+BENCHMARK_TEMPLATE(BM_AnyCopy, Any);
+
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, int, int);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, int, unsigned);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, int, double);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, double, double);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, double, int);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, Color, Color);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, std::string, std::string);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, int, std::string);
+BENCHMARK_TEMPLATE(BM_AnyCast, LegacyAny, std::vector<double>, std::vector<double>);
+BENCHMARK_TEMPLATE(BM_AnyConstruct, LegacyAny);
+BENCHMARK_TEMPLATE(BM_AnyCopy, LegacyAny);
@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/blackboard.h"
+
+using namespace BT;
+
+namespace
+{
+/* Stack of "depth" Blackboards, where the key [value] of the last one
+ * is remapped to [value] of the root one, like nested SubTrees do.
+ * front() is the root, back() the innermost Blackboard.
+ */
+std::vector<Blackboard::Ptr> remappedStack(int depth)
+{
+    std::vector<Blackboard::Ptr> stack;
+    stack.push_back(Blackboard::create());
+    for (int i = 0; i < depth; i++)
+    {
+        auto bb = Blackboard::create(stack.back());
+        bb->addSubtreeRemapping("value", "value");
+        stack.push_back(bb);
+    }
+    return stack;
+}
+}
+
+// Range(0): number of remapping levels (0 means direct access)
+static void BM_BlackboardSetInt(benchmark::State& state)
+{
+    auto stack = remappedStack(static_cast<int>(state.range(0)));
+    auto bb = stack.back();
+    int value = 0;
+    for (auto _ : state)
+    {
+        bb->set("value", value++);
+    }
+}
+
+static void BM_BlackboardGetInt(benchmark::State& state)
+{
+    auto stack = remappedStack(static_cast<int>(state.range(0)));
+    auto bb = stack.back();
+    bb->set("value", 42);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bb->get<int>("value"));
+    }
+}
+
+static void BM_BlackboardSetString(benchmark::State& state)
+{
+    auto stack = remappedStack(static_cast<int>(state.range(0)));
+    auto bb = stack.back();
+    const std::string text = "a string longer than the small string optimization";
+    for (auto _ : state)
+    {
+        bb->set("value", text);
+    }
+}
+
+static void BM_BlackboardGetString(benchmark::State& state)
+{
+    auto stack = remappedStack(static_cast<int>(state.range(0)));
+    auto bb = stack.back();
+    bb->set("value", std::string("a string longer than the small string optimization"));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bb->get<std::string>("value"));
+    }
+}
+
+// Every thread reads and writes its own key of the same Blackboard
+static void BM_BlackboardThreadsDistinctKeys(benchmark::State& state)
+{
+    static auto bb = Blackboard::create();
+    const std::string key = "value_" + std::to_string(state.thread_index());
+    bb->set(key, std::string("a string longer than the small string optimization"));
+    for (auto _ : state)
+    {
+        bb->set(key, std::string("a string longer than the small string optimization"));
+        benchmark::DoNotOptimize(bb->get<std::string>(key));
+    }
+}
+
+// All the threads read and write the same key
+static void BM_BlackboardThreadsSameKey(benchmark::State& state)
+{
+    static auto bb = Blackboard::create();
+    bb->set("value", std::string("a string longer than the small string optimization"));
+    for (auto _ : state)
+    {
+        bb->set("value", std::string("a string longer than the small string optimization"));
+        benchmark::DoNotOptimize(bb->get<std::string>("value"));
+    }
+}
+
+// Range(0): number of doubles in the vector. Range(1): 1 to move it into the
+// Blackboard, 0 to copy it. The vector is created in each iteration.
+static void BM_BlackboardSetVector(benchmark::State& state)
+{
+    auto bb = Blackboard::create();
+    const bool move = state.range(1) != 0;
+    for (auto _ : state)
+    {
+        std::vector<double> value(static_cast<size_t>(state.range(0)), 1.0);
+        if (move)
+        {
+            bb->set("value", std::move(value));
+        }
+        else
+        {
+            bb->set("value", value);
+        }
+    }
+    state.SetLabel(move ? "move" : "copy");
+}
+
+static void BM_BlackboardGetVector(benchmark::State& state)
+{
+    auto bb = Blackboard::create();
+    bb->set("value", std::vector<double>(static_cast<size_t>(state.range(0)), 1.0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bb->get<std::vector<double>>("value").back());
+    }
+}
+
+static void BM_BlackboardBorrowVector(benchmark::State& state)
+{
+    auto bb = Blackboard::create();
+    bb->set("value", std::vector<double>(static_cast<size_t>(state.range(0)), 1.0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(bb->borrow<std::vector<double>>("value")->back());
+    }
+}
+
+BENCHMARK(BM_BlackboardSetInt)->Arg(0)->Arg(1)->Arg(3)->Arg(7);
+BENCHMARK(BM_BlackboardGetInt)->Arg(0)->Arg(1)->Arg(3)->Arg(7);
+BENCHMARK(BM_BlackboardSetString)->Arg(0)->Arg(1)->Arg(3)->Arg(7);
+BENCHMARK(BM_BlackboardGetString)->Arg(0)->Arg(1)->Arg(3)->Arg(7);
+BENCHMARK(BM_BlackboardThreadsDistinctKeys)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_BlackboardThreadsSameKey)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_BlackboardSetVector)->Args({ 1 << 10, 0 })->Args({ 1 << 10, 1 })->Args({ 1 << 16, 0 })->Args({ 1 << 16, 1 });
+BENCHMARK(BM_BlackboardGetVector)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_BlackboardBorrowVector)->Arg(1 << 10)->Arg(1 << 16);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/basic_types.h"
+
+using namespace BT;
+
+namespace
+{
+// "count" numbers separated by ';', like the waypoints of a path
+std::string numbersList(int count, bool real)
+{
+    std::string text;
+    for (int i = 0; i < count; i++)
+    {
+        if (i > 0)
+        {
+            text += ';';
+        }
+        text += real ? std::to_string(i * 0.731 - 12.5) : std::to_string(i * 37 - 500);
+    }
+    return text;
+}
+
+template <typename T>
+const char* numberText();
+
+template <> const char* numberText<int>() { return "-123456"; }
+template <> const char* numberText<unsigned>() { return "123456"; }
+template <> const char* numberText<double>() { return "-3.14159"; }
+
+template <typename T>
+void BM_ConvertNumber(benchmark::State& state)
+{
+    const StringView text = numberText<T>();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(convertFromString<T>(text));
+    }
+}
+
+// Range(0): count of numbers in the list
+template <typename T>
+void BM_ConvertList(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+    const std::string text = numbersList(count, std::is_floating_point<T>::value);
+    for (auto _ : state)
+    {
+        auto output = convertFromString<std::vector<T>>(text);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+// Range(0): count of parts
+void BM_SplitString(benchmark::State& state)
+{
+    const std::string text = numbersList(static_cast<int>(state.range(0)), true);
+    for (auto _ : state)
+    {
+        auto parts = splitString(text, ';');
+        benchmark::DoNotOptimize(parts.data());
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+
+// Range(0): count of parts
+void BM_ForEachSplit(benchmark::State& state)
+{
+    const std::string text = numbersList(static_cast<int>(state.range(0)), true);
+    for (auto _ : state)
+    {
+        size_t total = 0;
+        forEachSplit(text, ';', [&total](StringView part) { total += part.size(); });
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+}
+
+BENCHMARK_TEMPLATE(BM_ConvertNumber, int);
+BENCHMARK_TEMPLATE(BM_ConvertNumber, unsigned);
+BENCHMARK_TEMPLATE(BM_ConvertNumber, double);
+BENCHMARK_TEMPLATE(BM_ConvertList, int)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_ConvertList, double)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_SplitString)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_ForEachSplit)->Arg(10)->Arg(100)->Arg(1000);
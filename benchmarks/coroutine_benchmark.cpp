@@ -0,0 +1,208 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "behaviortree_cpp_v3/action_node.h"
+
+using namespace BT;
+
+namespace
+{
+// Yields once, then succeeds.
+class YieldOnceAction : public CoroActionNode
+{
+  public:
+    YieldOnceAction(const std::string& name, const NodeConfiguration& config)
+      : CoroActionNode(name, config)
+    {}
+
+    NodeStatus tick() override
+    {
+        setStatusRunningAndYield();
+        return NodeStatus::SUCCESS;
+    }
+};
+
+// Yields forever.
+class YieldForeverAction : public CoroActionNode
+{
+  public:
+    YieldForeverAction(const std::string& name, const NodeConfiguration& config)
+      : CoroActionNode(name, config)
+    {}
+
+    NodeStatus tick() override
+    {
+        while (true)
+        {
+            setStatusRunningAndYield();
+        }
+    }
+};
+
+#ifdef BT_CPP20_COROUTINES
+class StacklessYieldOnceAction : public StacklessCoroActionNode
+{
+  public:
+    StacklessYieldOnceAction(const std::string& name, const NodeConfiguration& config)
+      : StacklessCoroActionNode(name, config)
+    {}
+
+    Task coroTick() override
+    {
+        co_await yield();
+        co_return NodeStatus::SUCCESS;
+    }
+};
+
+class StacklessYieldForeverAction : public StacklessCoroActionNode
+{
+  public:
+    StacklessYieldForeverAction(const std::string& name, const NodeConfiguration& config)
+      : StacklessCoroActionNode(name, config)
+    {}
+
+    Task coroTick() override
+    {
+        while (true)
+        {
+            co_await yield();
+        }
+    }
+};
+
+// The nodes of a Tree share its FramePool.
+NodeConfiguration stacklessConfig()
+{
+    NodeConfiguration config;
+    config.frame_pool = std::make_shared<FramePool>();
+    return config;
+}
+#endif
+
+// Each iteration starts the coroutine of the action and completes it.
+void BM_CoroActionStartComplete(benchmark::State& state)
+{
+    NodeConfiguration config;
+    YieldOnceAction action("action", config);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(action.executeTick());
+        benchmark::DoNotOptimize(action.executeTick());
+    }
+}
+
+// Each iteration starts the coroutine of the action and halts it.
+void BM_CoroActionStartHalt(benchmark::State& state)
+{
+    NodeConfiguration config;
+    YieldOnceAction action("action", config);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(action.executeTick());
+        action.halt();
+        action.setStatus(NodeStatus::IDLE);
+    }
+}
+
+// Each iteration resumes the coroutine once.
+void BM_CoroActionResume(benchmark::State& state)
+{
+    NodeConfiguration config;
+    YieldForeverAction action("action", config);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(action.executeTick());
+    }
+}
+
+// Range(0): number of actions started before completing all of them, i.e.
+// number of stacks in use at the same time.
+void BM_CoroActionsConcurrent(benchmark::State& state)
+{
+    NodeConfiguration config;
+    std::vector<std::unique_ptr<YieldOnceAction>> actions;
+    for (int i = 0; i < state.range(0); i++)
+    {
+        actions.emplace_back(new YieldOnceAction("action", config));
+    }
+    for (auto _ : state)
+    {
+        for (auto& action: actions)
+        {
+            benchmark::DoNotOptimize(action->executeTick());
+        }
+        for (auto& action: actions)
+        {
+            benchmark::DoNotOptimize(action->executeTick());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#ifdef BT_CPP20_COROUTINES
+// Same as BM_CoroActionStartComplete, with a StacklessCoroActionNode.
+void BM_StacklessActionStartComplete(benchmark::State& state)
+{
+    StacklessYieldOnceAction action("action", stacklessConfig());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(action.executeTick());
+        benchmark::DoNotOptimize(action.executeTick());
+    }
+}
+
+void BM_StacklessActionStartHalt(benchmark::State& state)
+{
+    StacklessYieldOnceAction action("action", stacklessConfig());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(action.executeTick());
+        action.halt();
+        action.setStatus(NodeStatus::IDLE);
+    }
+}
+
+void BM_StacklessActionResume(benchmark::State& state)
+{
+    StacklessYieldForeverAction action("action", stacklessConfig());
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(action.executeTick());
+    }
+}
+
+void BM_StacklessActionsConcurrent(benchmark::State& state)
+{
+    const NodeConfiguration config = stacklessConfig();
+    std::vector<std::unique_ptr<StacklessYieldOnceAction>> actions;
+    for (int i = 0; i < state.range(0); i++)
+    {
+        actions.emplace_back(new StacklessYieldOnceAction("action", config));
+    }
+    for (auto _ : state)
+    {
+        for (auto& action: actions)
+        {
+            benchmark::DoNotOptimize(action->executeTick());
+        }
+        for (auto& action: actions)
+        {
+            benchmark::DoNotOptimize(action->executeTick());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#endif
+}
+
+BENCHMARK(BM_CoroActionStartComplete);
+BENCHMARK(BM_CoroActionStartHalt);
+BENCHMARK(BM_CoroActionResume);
+BENCHMARK(BM_CoroActionsConcurrent)->Arg(10)->Arg(100);
+
+#ifdef BT_CPP20_COROUTINES
+BENCHMARK(BM_StacklessActionStartComplete);
+BENCHMARK(BM_StacklessActionStartHalt);
+BENCHMARK(BM_StacklessActionResume);
+BENCHMARK(BM_StacklessActionsConcurrent)->Arg(10)->Arg(100);
+#endif
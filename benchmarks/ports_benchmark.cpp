@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/bt_factory.h"
+
+using namespace BT;
+
+namespace
+{
+class PortsNode : public SyncActionNode
+{
+  public:
+    PortsNode(const std::string& name, const NodeConfiguration& config)
+      : SyncActionNode(name, config)
+    {}
+
+    NodeStatus tick() override
+    {
+        return NodeStatus::SUCCESS;
+    }
+
+    static PortsList providedPorts()
+    {
+        return { InputPort<int>("in_int"), InputPort<double>("in_double"),
+                 InputPort<std::string>("in_string"), OutputPort<int>("out_int") };
+    }
+};
+
+const char* xml_literal = R"(
+<root>
+    <BehaviorTree>
+        <PortsNode in_int="42" in_double="3.14" in_string="hello" out_int="{out}"/>
+    </BehaviorTree>
+</root>)";
+
+const char* xml_blackboard = R"(
+<root>
+    <BehaviorTree>
+        <PortsNode in_int="{int}" in_double="{double}" in_string="{string}" out_int="{out}"/>
+    </BehaviorTree>
+</root>)";
+
+// Range(0): 1 if the ports point to the blackboard, 0 if they contain a literal.
+Tree createPortsTree(BehaviorTreeFactory& factory, bool use_blackboard)
+{
+    factory.registerNodeType<PortsNode>("PortsNode");
+    auto tree = factory.createTreeFromText(use_blackboard ? xml_blackboard : xml_literal);
+    auto bb = tree.rootBlackboard();
+    bb->set("int", 42);
+    bb->set("double", 3.14);
+    bb->set("string", std::string("hello"));
+    return tree;
+}
+
+template <typename T>
+const char* portName();
+
+template <> const char* portName<int>() { return "in_int"; }
+template <> const char* portName<double>() { return "in_double"; }
+template <> const char* portName<std::string>() { return "in_string"; }
+
+template <typename T>
+void BM_GetInput(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    const bool use_blackboard = state.range(0) != 0;
+    auto tree = createPortsTree(factory, use_blackboard);
+    const TreeNode* node = tree.root_node;
+    const std::string key(portName<T>());
+    T value;
+    for (auto _ : state)
+    {
+        if (!node->getInput(key, value))
+        {
+            state.SkipWithError("getInput failed");
+            break;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetLabel(use_blackboard ? "blackboard" : "literal");
+}
+
+template <typename T>
+void BM_GetInputHandle(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    const bool use_blackboard = state.range(0) != 0;
+    auto tree = createPortsTree(factory, use_blackboard);
+    const auto handle = tree.root_node->getInputHandle<T>(portName<T>());
+    T value;
+    for (auto _ : state)
+    {
+        if (!handle.get(value))
+        {
+            state.SkipWithError("PortHandle::get failed");
+            break;
+        }
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetLabel(use_blackboard ? "blackboard" : "literal");
+}
+}
+
+static void BM_SetOutput(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    auto tree = createPortsTree(factory, true);
+    TreeNode* node = tree.root_node;
+    const std::string key("out_int");
+    int value = 0;
+    for (auto _ : state)
+    {
+        if (!node->setOutput(key, value++))
+        {
+            state.SkipWithError("setOutput failed");
+            break;
+        }
+    }
+}
+
+static void BM_SetOutputHandle(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    auto tree = createPortsTree(factory, true);
+    auto handle = tree.root_node->getOutputHandle<int>("out_int");
+    int value = 0;
+    for (auto _ : state)
+    {
+        if (!handle.set(value++))
+        {
+            state.SkipWithError("PortHandle::set failed");
+            break;
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_GetInput, int)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_GetInput, double)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_GetInput, std::string)->Arg(0)->Arg(1);
+BENCHMARK(BM_SetOutput);
+BENCHMARK_TEMPLATE(BM_GetInputHandle, int)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_GetInputHandle, double)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_GetInputHandle, std::string)->Arg(0)->Arg(1);
+BENCHMARK(BM_SetOutputHandle);
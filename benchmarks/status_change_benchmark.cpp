@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/behavior_tree.h"
+
+using namespace BT;
+
+// Cost of a status transition, with and without an attached observer.
+static void BM_SetStatus(benchmark::State& state)
+{
+    AlwaysSuccessNode node("node");
+    const bool with_subscriber = state.range(0) != 0;
+
+    TreeNode::StatusChangeSubscriber subscriber;
+    if (with_subscriber)
+    {
+        subscriber = node.subscribeToStatusChange(
+            [](TimePoint, const TreeNode&, NodeStatus, NodeStatus) {});
+    }
+
+    for (auto _ : state)
+    {
+        node.setStatus(NodeStatus::RUNNING);
+        node.setStatus(NodeStatus::IDLE);
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+    state.SetLabel(with_subscriber ? "subscribed" : "no subscriber");
+}
+
+BENCHMARK(BM_SetStatus)->Arg(0)->Arg(1);
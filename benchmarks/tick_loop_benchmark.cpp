@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <thread>
+#include "behaviortree_cpp_v3/bt_factory.h"
+#include "behaviortree_cpp_v3/behavior_tree.h"
+
+using namespace BT;
+
+// The tree waits for an AsyncActionNode that takes 20 msec. "CPU" is the time
+// spent by the thread that ticks the tree, "ticks" the ticks of the root.
+namespace
+{
+class SleepAction : public AsyncActionNode
+{
+  public:
+    SleepAction(const std::string& name, const NodeConfiguration& config)
+      : AsyncActionNode(name, config)
+    {}
+
+    ~SleepAction() override
+    {
+        stopAndJoinThread();
+    }
+
+    NodeStatus tick() override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return NodeStatus::SUCCESS;
+    }
+
+    void halt() override
+    {}
+
+    static PortsList providedPorts()
+    {
+        return {};
+    }
+};
+
+Tree createSleepTree(BehaviorTreeFactory& factory)
+{
+    factory.registerNodeType<SleepAction>("SleepAction");
+    return factory.createTreeFromText(
+        "<root><BehaviorTree><Sequence><AlwaysSuccess/><SleepAction/></Sequence></BehaviorTree></root>");
+}
+
+// The usual loop: tick, then sleep for a fixed period. Range(0): period in usec.
+void BM_PollingTickLoop(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    auto tree = createSleepTree(factory);
+    const auto period = std::chrono::microseconds(state.range(0));
+    int64_t ticks = 0;
+
+    for (auto _ : state)
+    {
+        NodeStatus status = tree.root_node->executeTick();
+        ticks++;
+        while (status == NodeStatus::RUNNING)
+        {
+            std::this_thread::sleep_for(period);
+            status = tree.root_node->executeTick();
+            ticks++;
+        }
+    }
+    state.counters["ticks"] = benchmark::Counter(ticks, benchmark::Counter::kAvgIterations);
+}
+
+// The loop of Tree::tickWhileRunning(): the thread sleeps until the action
+// completes.
+void BM_EventDrivenTickLoop(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    auto tree = createSleepTree(factory);
+    int64_t ticks = 0;
+
+    for (auto _ : state)
+    {
+        NodeStatus status = tree.root_node->executeTick();
+        ticks++;
+        while (status == NodeStatus::RUNNING)
+        {
+            tree.sleep(std::chrono::seconds(1));
+            status = tree.root_node->executeTick();
+            ticks++;
+        }
+    }
+    state.counters["ticks"] = benchmark::Counter(ticks, benchmark::Counter::kAvgIterations);
+}
+}
+
+BENCHMARK(BM_PollingTickLoop)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EventDrivenTickLoop)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/bt_factory.h"
+#include "behaviortree_cpp_v3/behavior_tree.h"
+#include "behaviortree_cpp_v3/decorators/timer_queue.h"
+
+using namespace BT;
+
+namespace
+{
+// the timers are cancelled in an order different from the one of the deadlines
+size_t shuffledIndex(size_t i, size_t count)
+{
+    return (i * 7919) % count;
+}
+
+// Range(0): number of timers armed at the same time, then cancelled.
+void BM_TimerServiceArmCancel(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    TimerService service;
+    std::vector<uint64_t> ids(count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            ids[i] = service.add(std::chrono::milliseconds(10000 + i % 1000), []() {});
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            service.cancel(ids[shuffledIndex(i, count)]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// Same as BM_TimerServiceArmCancel, with the TimerQueue that each TimeoutNode
+// used to own.
+void BM_TimerQueueArmCancel(benchmark::State& state)
+{
+    const size_t count = static_cast<size_t>(state.range(0));
+    TimerQueue queue;
+    std::vector<uint64_t> ids(count);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            ids[i] = queue.add(std::chrono::milliseconds(10000 + i % 1000), [](bool) {});
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            queue.cancel(ids[shuffledIndex(i, count)]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+class KeepRunning : public ActionNodeBase
+{
+  public:
+    KeepRunning(const std::string& name, const NodeConfiguration& config)
+      : ActionNodeBase(name, config)
+    {}
+
+    NodeStatus tick() override
+    {
+        return NodeStatus::RUNNING;
+    }
+
+    void halt() override
+    {
+        setStatus(NodeStatus::IDLE);
+    }
+
+    static PortsList providedPorts()
+    {
+        return {};
+    }
+};
+
+// Range(0): number of TimeoutNodes in a Parallel. Each iteration arms all
+// their timers with a tick, then cancels them halting the tree.
+void BM_TimeoutNodesArmHalt(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<KeepRunning>("KeepRunning");
+    std::string xml = "<root><BehaviorTree><Parallel threshold=\"" + std::to_string(count) + "\">";
+    for (int i = 0; i < count; i++)
+    {
+        xml += "<Timeout msec=\"10000\"><KeepRunning/></Timeout>";
+    }
+    xml += "</Parallel></BehaviorTree></root>";
+    auto tree = factory.createTreeFromText(xml);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.root_node->executeTick());
+        haltAllActions(tree.root_node);
+        tree.root_node->halt();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+}
+
+BENCHMARK(BM_TimerServiceArmCancel)->Arg(100)->Arg(10000);
+BENCHMARK(BM_TimerQueueArmCancel)->Arg(100)->Arg(10000);
+BENCHMARK(BM_TimeoutNodesArmHalt)->Arg(100)->Arg(10000);
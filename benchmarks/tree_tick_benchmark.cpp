@@ -0,0 +1,225 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/bt_factory.h"
+#include <thread>
+
+using namespace BT;
+
+namespace
+{
+template <typename ControlT>
+ControlNode* makeControl(unsigned /*children_count*/)
+{
+    return new ControlT("control");
+}
+
+// all the children must succeed
+template <>
+ControlNode* makeControl<ParallelNode>(unsigned children_count)
+{
+    return new ParallelNode("control", children_count);
+}
+
+/* Deep chain of control nodes. Each level contains a leaf and the next level:
+ *
+ *   Control_0
+ *     Leaf
+ *     Control_1
+ *       Leaf
+ *       Control_2
+ *         ...
+ *
+ * It is built programmatically, because tinyxml2 limits the nesting depth.
+ */
+template <typename ControlT, typename LeafT>
+struct DeepTree
+{
+    std::vector<std::unique_ptr<TreeNode>> nodes;
+    TreeNode* root;
+
+    explicit DeepTree(int depth)
+    {
+        ControlNode* parent = nullptr;
+        for (int i = 0; i < depth; i++)
+        {
+            const bool last = (i == depth - 1);
+            auto control = makeControl<ControlT>(last ? 1 : 2);
+            nodes.emplace_back(control);
+            auto leaf = new LeafT("leaf");
+            nodes.emplace_back(leaf);
+            control->addChild(leaf);
+            if (parent)
+            {
+                parent->addChild(control);
+            }
+            parent = control;
+        }
+        root = nodes.front().get();
+    }
+};
+
+template <typename ControlT, typename LeafT>
+void BM_DeepTreeTick(benchmark::State& state)
+{
+    DeepTree<ControlT, LeafT> tree(static_cast<int>(state.range(0)));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.root->executeTick());
+    }
+    state.SetItemsProcessed(state.iterations() * tree.nodes.size());
+}
+
+/* Control node with "width" children of the same type, each one
+ * with "width" leaves.
+ */
+std::string wideTreeXML(const std::string& control, const std::string& leaf, int width)
+{
+    std::string open_tag = "<" + control + ">";
+    if (control == "Parallel")
+    {
+        open_tag = "<Parallel threshold=\"" + std::to_string(width) + "\">";
+    }
+    std::string xml = "<root><BehaviorTree>" + open_tag;
+    for (int i = 0; i < width; i++)
+    {
+        xml += open_tag;
+        for (int j = 0; j < width; j++)
+        {
+            xml += "<" + leaf + "/>";
+        }
+        xml += "</" + control + ">";
+    }
+    xml += "</" + control + "></BehaviorTree></root>";
+    return xml;
+}
+
+class ImmediateAsyncAction : public AsyncActionNode
+{
+  public:
+    ImmediateAsyncAction(const std::string& name, const NodeConfiguration& config)
+      : AsyncActionNode(name, config)
+    {}
+
+    ~ImmediateAsyncAction() override
+    {
+        stopAndJoinThread();
+    }
+
+    NodeStatus tick() override
+    {
+        return NodeStatus::SUCCESS;
+    }
+
+    void halt() override
+    {}
+
+    static PortsList providedPorts()
+    {
+        return {};
+    }
+};
+
+// Sequence of "width" decorators and controls that read literal ports at every tick.
+std::string literalPortsXML(int width)
+{
+    std::string xml = "<root><BehaviorTree><Sequence>";
+    for (int i = 0; i < width; i++)
+    {
+        xml += "<Timeout msec=\"1000\"><Repeat num_cycles=\"2\"><RetryUntilSuccesful num_attempts=\"3\">"
+               "<Parallel threshold=\"1\"><AlwaysSuccess/></Parallel>"
+               "</RetryUntilSuccesful></Repeat></Timeout>";
+    }
+    xml += "</Sequence></BehaviorTree></root>";
+    return xml;
+}
+
+void BM_WideTreeTick(benchmark::State& state, const char* control, const char* leaf)
+{
+    BehaviorTreeFactory factory;
+    auto tree = factory.createTreeFromText(wideTreeXML(control, leaf, static_cast<int>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.root_node->executeTick());
+    }
+    state.SetItemsProcessed(state.iterations() * tree.nodes.size());
+}
+}
+
+BENCHMARK_TEMPLATE(BM_DeepTreeTick, SequenceNode, AlwaysSuccessNode)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_DeepTreeTick, FallbackNode, AlwaysFailureNode)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_DeepTreeTick, ReactiveSequence, AlwaysSuccessNode)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_DeepTreeTick, ReactiveFallback, AlwaysFailureNode)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_DeepTreeTick, ParallelNode, AlwaysSuccessNode)->Arg(10)->Arg(100)->Arg(1000);
+
+BENCHMARK_CAPTURE(BM_WideTreeTick, Sequence, "Sequence", "AlwaysSuccess")->Arg(10)->Arg(100);
+BENCHMARK_CAPTURE(BM_WideTreeTick, Fallback, "Fallback", "AlwaysFailure")->Arg(10)->Arg(100);
+BENCHMARK_CAPTURE(BM_WideTreeTick, ReactiveSequence, "ReactiveSequence", "AlwaysSuccess")->Arg(10)->Arg(100);
+BENCHMARK_CAPTURE(BM_WideTreeTick, ReactiveFallback, "ReactiveFallback", "AlwaysFailure")->Arg(10)->Arg(100);
+BENCHMARK_CAPTURE(BM_WideTreeTick, Parallel, "Parallel", "AlwaysSuccess")->Arg(10)->Arg(100);
+
+// Range(0): width of the tree. Range(1): 1 if the NodeArena is used.
+static void BM_FactoryTreeTick(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    factory.enableNodeArena(state.range(1) != 0);
+    auto tree = factory.createTreeFromText(
+        wideTreeXML("Sequence", "AlwaysSuccess", static_cast<int>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.root_node->executeTick());
+    }
+    state.SetItemsProcessed(state.iterations() * tree.nodes.size());
+    state.SetLabel(state.range(1) ? "arena" : "heap");
+}
+
+BENCHMARK(BM_FactoryTreeTick)->Args({ 10, 0 })->Args({ 10, 1 })->Args({ 100, 0 })->Args({ 100, 1 });
+
+// Range(0): number of Timeout/Repeat/Retry/Parallel groups.
+static void BM_LiteralPortsTick(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    auto tree = factory.createTreeFromText(literalPortsXML(static_cast<int>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(tree.root_node->executeTick());
+    }
+    state.SetItemsProcessed(state.iterations() * tree.nodes.size());
+}
+
+BENCHMARK(BM_LiteralPortsTick)->Arg(10)->Arg(100);
+
+// Range(0): number of AsyncActionNodes in a Parallel. Range(1): 1 if they use
+// a ThreadPool with 4 threads, 0 if each node starts its own thread.
+// The tree is created and ticked until all the actions are completed.
+static void BM_AsyncActionsRun(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<ImmediateAsyncAction>("ImmediateAsync");
+    if (state.range(1) != 0)
+    {
+        factory.setAsyncExecutor(std::make_shared<ThreadPool>(4));
+    }
+    std::string xml = "<root><BehaviorTree><Parallel threshold=\"" + std::to_string(count) + "\">";
+    for (int i = 0; i < count; i++)
+    {
+        xml += "<ImmediateAsync/>";
+    }
+    xml += "</Parallel></BehaviorTree></root>";
+    const auto blueprint = factory.createBlueprintFromText(xml);
+
+    for (auto _ : state)
+    {
+        auto tree = blueprint.instantiate(Blackboard::create());
+        while (tree.root_node->executeTick() == NodeStatus::RUNNING)
+        {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetLabel(state.range(1) ? "pool" : "thread per node");
+}
+
+BENCHMARK(BM_AsyncActionsRun)->Args({ 10, 0 })->Args({ 10, 1 })->Args({ 100, 0 })->Args({ 100, 1 })->UseRealTime();
@@ -0,0 +1,268 @@
+#include <benchmark/benchmark.h>
+#include "behaviortree_cpp_v3/bt_factory.h"
+#include "behaviortree_cpp_v3/xml_parsing.h"
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+using namespace BT;
+
+namespace
+{
+/* Main tree with "count" subtrees, each one a Sequence of 10 leaves
+ * with a couple of attributes: the size of the text grows linearly with count.
+ */
+std::string manySubtreesXML(int count)
+{
+    std::string xml = "<root main_tree_to_execute=\"MainTree\">\n";
+    for (int i = 0; i < count; i++)
+    {
+        xml += "<BehaviorTree ID=\"Sub" + std::to_string(i) + "\">\n<Sequence name=\"seq\">\n";
+        for (int j = 0; j < 10; j++)
+        {
+            xml += "  <SetBlackboard output_key=\"key_" + std::to_string(j) +
+                   "\" value=\"" + std::to_string(i * j) + "\"/>\n";
+        }
+        xml += "</Sequence>\n</BehaviorTree>\n";
+    }
+    xml += "<BehaviorTree ID=\"MainTree\">\n<Sequence>\n";
+    for (int i = 0; i < count; i++)
+    {
+        xml += "  <SubTree ID=\"Sub" + std::to_string(i) + "\"/>\n";
+    }
+    xml += "</Sequence>\n</BehaviorTree>\n</root>\n";
+    return xml;
+}
+
+/* Single tree with about "count" nodes: Sequences of 100 leaves, each
+ * one with two remapped ports.
+ */
+std::string largeTreeXML(int count)
+{
+    std::string xml = "<root main_tree_to_execute=\"MainTree\">\n"
+                      "<BehaviorTree ID=\"MainTree\">\n<Sequence>\n";
+    for (int i = 0; i < count / 100; i++)
+    {
+        xml += "<Sequence>\n";
+        for (int j = 0; j < 99; j++)
+        {
+            xml += "  <SetBlackboard output_key=\"key_" + std::to_string(j) +
+                   "\" value=\"{value_" + std::to_string(i) + "}\"/>\n";
+        }
+        xml += "</Sequence>\n";
+    }
+    xml += "</Sequence>\n</BehaviorTree>\n</root>\n";
+    return xml;
+}
+
+// Range(0): number of subtrees. Range(1): 1 if VerifyXML is used.
+void BM_XMLLoad(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    factory.enableXMLVerification(state.range(1) != 0);
+    const std::string xml = manySubtreesXML(static_cast<int>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        XMLParser parser(factory);
+        parser.loadFromText(xml);
+    }
+    state.SetBytesProcessed(state.iterations() * xml.size());
+    state.SetLabel(state.range(1) ? "verified" : "unverified");
+}
+
+// Range(0): number of subtrees. Range(1): 1 if XMLDocumentCache is used.
+void BM_XMLLoadFile(benchmark::State& state)
+{
+    const std::string xml = manySubtreesXML(static_cast<int>(state.range(0)));
+    const std::string file_path = "/tmp/bt_benchmark_" + std::to_string(state.range(0)) + ".xml";
+    {
+        std::ofstream file(file_path);
+        file << xml;
+    }
+    BehaviorTreeFactory factory;
+    if (state.range(1))
+    {
+        factory.setXMLDocumentCache(std::make_shared<XMLDocumentCache>());
+    }
+
+    for (auto _ : state)
+    {
+        XMLParser parser(factory);
+        parser.loadFromFile(file_path);
+    }
+    std::remove(file_path.c_str());
+    state.SetBytesProcessed(state.iterations() * xml.size());
+    state.SetLabel(state.range(1) ? "cached" : "uncached");
+}
+
+// Same as above, including the instantiation of the tree.
+void BM_XMLCreateTree(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    factory.enableXMLVerification(state.range(1) != 0);
+    const std::string xml = manySubtreesXML(static_cast<int>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(factory.createTreeFromText(xml));
+    }
+    state.SetBytesProcessed(state.iterations() * xml.size());
+    state.SetLabel(state.range(1) ? "verified" : "unverified");
+}
+
+// Range(0): number of nodes. Parse, compile and instantiate a large tree.
+void BM_CreateLargeTree(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    factory.enableXMLVerification(false);
+    const std::string xml = largeTreeXML(static_cast<int>(state.range(0)));
+
+    size_t nodes_count = 0;
+    for (auto _ : state)
+    {
+        Tree tree = factory.createTreeFromText(xml);
+        nodes_count = tree.nodes.size();
+    }
+    state.SetItemsProcessed(state.iterations() * nodes_count);
+}
+
+// Range(0): number of nodes. Only the compilation of the parsed XML.
+void BM_CompileLargeTree(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    factory.enableXMLVerification(false);
+    XMLParser parser(factory);
+    parser.loadFromText(largeTreeXML(static_cast<int>(state.range(0))));
+
+    size_t nodes_count = 0;
+    for (auto _ : state)
+    {
+        nodes_count = parser.createBlueprint().nodesCount();
+    }
+    state.SetItemsProcessed(state.iterations() * nodes_count);
+}
+
+// Same trees of BM_XMLCreateTree, stamped out from a TreeBlueprint.
+void BM_BlueprintInstantiate(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    const auto blueprint =
+        factory.createBlueprintFromText(manySubtreesXML(static_cast<int>(state.range(0))));
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(blueprint.instantiate());
+    }
+    state.SetItemsProcessed(state.iterations() * blueprint.nodesCount());
+}
+
+// Range(0): number of subtrees. Range(1): 1 if the SubTrees are lazy.
+// Only the startup is measured: the lazy SubTrees are never ticked.
+void BM_LazyInstantiate(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    factory.enableLazySubtrees(state.range(1) != 0);
+    const auto blueprint =
+        factory.createBlueprintFromText(manySubtreesXML(static_cast<int>(state.range(0))));
+
+    size_t nodes_count = 0;
+    for (auto _ : state)
+    {
+        Tree tree = blueprint.instantiate();
+        nodes_count = tree.nodes.size();
+    }
+    state.counters["nodes"] = static_cast<double>(nodes_count);
+    state.SetLabel(state.range(1) ? "lazy" : "eager");
+}
+
+// Range(0): number of subtrees. Range(1): 1 if the binary format is used.
+void BM_BlueprintLoad(benchmark::State& state)
+{
+    BehaviorTreeFactory factory;
+    const std::string xml = manySubtreesXML(static_cast<int>(state.range(0)));
+    const auto buffer = factory.createBlueprintFromText(xml).serialize();
+    const bool binary = state.range(1) != 0;
+
+    for (auto _ : state)
+    {
+        if (binary)
+        {
+            benchmark::DoNotOptimize(factory.createBlueprintFromBinary(buffer.data(), buffer.size()));
+        }
+        else
+        {
+            benchmark::DoNotOptimize(factory.createBlueprintFromText(xml));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * (binary ? buffer.size() : xml.size()));
+    state.SetLabel(binary ? "binary" : "xml");
+}
+
+// Action that spends some time in its constructor, to simulate a connection
+// to a server.
+class SlowConstructorAction : public SyncActionNode
+{
+  public:
+    SlowConstructorAction(const std::string& name, const NodeConfiguration& config)
+      : SyncActionNode(name, config)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    NodeStatus tick() override
+    {
+        return NodeStatus::SUCCESS;
+    }
+
+    static PortsList providedPorts()
+    {
+        return {};
+    }
+};
+
+// Range(0): number of subtrees, each one with 10 SlowConstructorAction.
+// Range(1): instantiation threads.
+void BM_ParallelInstantiate(benchmark::State& state)
+{
+    const int count = static_cast<int>(state.range(0));
+    std::string xml = "<root main_tree_to_execute=\"MainTree\">\n";
+    for (int i = 0; i < count; i++)
+    {
+        xml += "<BehaviorTree ID=\"Sub" + std::to_string(i) + "\"><Sequence>";
+        for (int j = 0; j < 10; j++)
+        {
+            xml += "<Slow/>";
+        }
+        xml += "</Sequence></BehaviorTree>\n";
+    }
+    xml += "<BehaviorTree ID=\"MainTree\"><Sequence>";
+    for (int i = 0; i < count; i++)
+    {
+        xml += "<SubTree ID=\"Sub" + std::to_string(i) + "\"/>";
+    }
+    xml += "</Sequence></BehaviorTree></root>\n";
+
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SlowConstructorAction>("Slow");
+    factory.setInstantiationThreads(static_cast<unsigned>(state.range(1)));
+    const auto blueprint = factory.createBlueprintFromText(xml);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(blueprint.instantiate());
+    }
+    state.SetItemsProcessed(state.iterations() * blueprint.nodesCount());
+}
+}
+
+BENCHMARK(BM_XMLLoad)->ArgsProduct({ { 1, 10, 100, 1000 }, { 0, 1 } });
+BENCHMARK(BM_XMLLoadFile)->ArgsProduct({ { 10, 100, 1000 }, { 0, 1 } });
+BENCHMARK(BM_XMLCreateTree)->ArgsProduct({ { 1, 10, 100 }, { 0, 1 } });
+BENCHMARK(BM_CreateLargeTree)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CompileLargeTree)->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BlueprintInstantiate)->Arg(1)->Arg(10)->Arg(100);
+BENCHMARK(BM_LazyInstantiate)->ArgsProduct({ { 10, 100, 1000 }, { 0, 1 } });
+BENCHMARK(BM_BlueprintLoad)->ArgsProduct({ { 1, 10, 100, 1000 }, { 0, 1 } });
+BENCHMARK(BM_ParallelInstantiate)->ArgsProduct({ { 8, 32 }, { 1, 4, 8 } })->UseRealTime();
@@ -0,0 +1,6 @@
+# Loaded by find_package(behaviortree_cpp_v3) when the library is built with
+# BT_CPP20_COROUTINES: the headers must be compiled with the same definitions.
+if(NOT CMAKE_CXX_STANDARD OR CMAKE_CXX_STANDARD LESS 20)
+    set(CMAKE_CXX_STANDARD 20)
+endif()
+add_definitions(-DBT_CPP20_COROUTINES -Dnsel_CONFIG_SELECT_EXPECTED=nsel_EXPECTED_NONSTD)
@@ -17,6 +17,14 @@
 #include <atomic>
 #include <thread>
 #include "leaf_node.h"
+#include "behaviortree_cpp_v3/utils/thread_pool.h"
+
+#ifdef BT_CPP20_COROUTINES
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "behaviortree_cpp_v3/utils/frame_pool.h"
+#endif
 
 namespace BT
 {
@@ -101,6 +109,13 @@ class SimpleActionNode : public SyncActionNode
  *
  * The user must implement the methods tick() and halt().
  *
+ * By default, each instance starts its own thread, the first time it is ticked,
+ * and the thread lives as long as the node. If NodeConfiguration::async_executor
+ * is set (see BehaviorTreeFactory::setAsyncExecutor()), tick() is executed by
+ * that ThreadPool instead, shared with the other nodes.
+ *
+ * When tick() returns, emitWakeUpSignal() wakes up Tree::sleep().
+ *
  * WARNING: this should probably be deprecated. It is too easy to use incorrectly
  * and there is not a good way to halt it in a thread safe way.
  *
@@ -127,10 +142,22 @@ class AsyncActionNode : public ActionNodeBase
 
     void notifyStart();
 
+    // Post the execution of tick() to the executor, unless it is running already.
+    void startInExecutor(ThreadPool& executor);
+
+    // The task posted to the executor
+    void executorTask();
+
+    bool taskRunning();
+
     std::atomic<bool> keep_thread_alive_;
 
+    // with the executor: tick() must be executed again by the running task
     bool start_action_;
 
+    // with the executor: a task of this node is queued or running
+    bool task_running_;
+
     std::mutex start_mutex_;
 
     std::condition_variable start_signal_;
@@ -189,12 +216,21 @@ class StatefulActionNode : public ActionNodeBase
  *
  * It is up to the user to decide when to suspend execution of the Action and resume
  * the parent node, invoking the method setStatusRunningAndYield().
+ *
+ * The stack of the coroutine is taken from CoroutineStackPool::forNodeType()
+ * when the action starts and given back when it completes or is halted.
+ * Its size is CoroutineStackPool::DEFAULT_STACK_SIZE, unless the derived class
+ * passes a different stack_size; CoroutineStackPool::reportNodeTypes()
+ * estimates how much is actually used (a lower bound).
  */
 class CoroActionNode : public ActionNodeBase
 {
   public:
 
     CoroActionNode(const std::string& name, const NodeConfiguration& config);
+
+    CoroActionNode(const std::string& name, const NodeConfiguration& config,
+                   size_t stack_size);
     virtual ~CoroActionNode() override;
 
     /// Use this method to return RUNNING and temporary "pause" the Action.
@@ -223,6 +259,217 @@ class CoroActionNode : public ActionNodeBase
 };
 #endif
 
+#ifdef BT_CPP20_COROUTINES
+
+/**
+ * @brief The StacklessCoroActionNode is an action implemented as a C++20
+ * coroutine: the user implements coroTick() instead of tick().
+ *
+ * Unlike CoroActionNode, it doesn't need a stack, nor a context switch to
+ * suspend: the state of the coroutine is kept in a frame allocated from
+ * NodeConfiguration::frame_pool when the action starts, and released when it
+ * completes or is halted. Halting the action destroys the frame, calling the
+ * destructors of the local variables of coroTick().
+ *
+ * If the node is destroyed while RUNNING, the frame is destroyed by
+ * ~StacklessCoroActionNode(), when the members of the derived class are gone
+ * already. If the local variables of coroTick() access them when destroyed,
+ * the derived class must call halt() in its destructor:
+ *
+ *     MyAction::~MyAction()
+ *     {
+ *         halt();
+ *     }
+ *
+ *     StacklessCoroActionNode::Task MyAction::coroTick()
+ *     {
+ *         sendRequest();
+ *         co_await waitUntil([this]() { return replyReceived(); });
+ *         co_return NodeStatus::SUCCESS;
+ *     }
+ *
+ * Inside coroTick():
+ *
+ *  - co_await yield() returns RUNNING; the next tick continues from there.
+ *  - co_await waitUntil(predicate) returns RUNNING until predicate() is true.
+ *    The following ticks call predicate() without resuming the coroutine.
+ *  - co_await of any other awaitable that suspends is the same as yield():
+ *    the coroutine is resumed by the next tick, never by the awaitable.
+ *  - co_return NodeStatus::SUCCESS or NodeStatus::FAILURE completes the action.
+ *
+ * Available only if the library is built with the CMake option BT_CPP20_COROUTINES.
+ */
+class StacklessCoroActionNode : public ActionNodeBase
+{
+  public:
+    /// The return type of coroTick().
+    class Task
+    {
+      public:
+        struct promise_type
+        {
+            Task get_return_object()
+            {
+                return Task( std::coroutine_handle<promise_type>::from_promise(*this) );
+            }
+
+            // the coroutine is started by the first tick
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_value(NodeStatus status)
+            {
+                result = status;
+            }
+
+            void unhandled_exception()
+            {
+                exception = std::current_exception();
+            }
+
+            // coroTick() is a member function: node is the object
+            static void* operator new(std::size_t size, StacklessCoroActionNode& node)
+            {
+                return allocateFrame( size, node.config().frame_pool.get() );
+            }
+
+            static void* operator new(std::size_t size)
+            {
+                return allocateFrame( size, nullptr );
+            }
+
+            static void operator delete(void* ptr, std::size_t size)
+            {
+                deallocateFrame( ptr, size );
+            }
+
+            NodeStatus result = NodeStatus::IDLE;
+            std::exception_ptr exception;
+            // set by waitUntil(): the coroutine is resumed when ready(ready_arg)
+            bool (*ready)(void*) = nullptr;
+            void* ready_arg = nullptr;
+        };
+
+        Task() = default;
+
+        Task(Task&& other) noexcept:
+          handle_( std::exchange(other.handle_, nullptr) )
+        {}
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if( this != &other )
+            {
+                reset();
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+
+        ~Task()
+        {
+            reset();
+        }
+
+      private:
+        friend class StacklessCoroActionNode;
+
+        explicit Task(std::coroutine_handle<promise_type> handle):
+          handle_(handle)
+        {}
+
+        void reset()
+        {
+            if( handle_ )
+            {
+                handle_.destroy();
+                handle_ = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    struct YieldAwaiter
+    {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<>) const noexcept
+        {}
+        void await_resume() const noexcept
+        {}
+    };
+
+    template <typename Predicate>
+    struct WaitUntilAwaiter
+    {
+        Predicate predicate;
+
+        bool await_ready()
+        {
+            return predicate();
+        }
+        void await_suspend(std::coroutine_handle<Task::promise_type> handle)
+        {
+            handle.promise().ready = &WaitUntilAwaiter::check;
+            handle.promise().ready_arg = this;
+        }
+        void await_resume() const noexcept
+        {}
+
+        static bool check(void* self)
+        {
+            return static_cast<WaitUntilAwaiter*>(self)->predicate();
+        }
+    };
+
+    StacklessCoroActionNode(const std::string& name, const NodeConfiguration& config);
+
+    /// Destroys the frame, if the action is RUNNING: see halt().
+    virtual ~StacklessCoroActionNode() override = default;
+
+    /** Destroy the frame of the coroutine. If you override this method,
+    * remember to call this implementation too.
+    */
+    void halt() override;
+
+  protected:
+    /// Method to be implemented by the user, instead of tick().
+    virtual Task coroTick() = 0;
+
+    /// co_await yield(): return RUNNING and continue from here at the next tick.
+    static YieldAwaiter yield()
+    {
+        return {};
+    }
+
+    /// co_await waitUntil(predicate): return RUNNING until predicate() is true.
+    template <typename Predicate>
+    static WaitUntilAwaiter<Predicate> waitUntil(Predicate predicate)
+    {
+        return { std::move(predicate) };
+    }
+
+  private:
+    NodeStatus tick() override final;
+
+    static void* allocateFrame(std::size_t size, FramePool* pool);
+
+    static void deallocateFrame(void* ptr, std::size_t size);
+
+    Task task_;
+};
+#endif
+
 }   //end namespace
 
 #endif
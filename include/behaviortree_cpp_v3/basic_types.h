@@ -2,6 +2,7 @@
 #define BT_BASIC_TYPES_H
 
 #include <iostream>
+#include <cstring>
 #include <vector>
 #include <sstream>
 #include <unordered_map>
@@ -75,6 +76,8 @@ std::string convertFromString<std::string>(StringView str);
 template <>
 const char* convertFromString<const char*>(StringView str);
 
+// The numbers are parsed without allocating memory and independently from the
+// locale. Spaces around the number are ignored, anything else throws RuntimeError.
 template <>
 int convertFromString<int>(StringView str);
 
@@ -155,6 +158,26 @@ std::ostream& operator<<(std::ostream& os, const BT::PortDirection& type);
 // Small utility, unless you want to use <boost/algorithm/string.hpp>
 std::vector<StringView> splitString(const StringView& strToSplit, char delimeter);
 
+/**
+ * @brief forEachSplit calls func(part) for each part of str separated by
+ * delimiter: the same parts returned by splitString(), without allocating
+ * the vector.
+ */
+template <typename Func>
+void forEachSplit(StringView str, char delimiter, Func&& func)
+{
+    const char* pos = str.data();
+    const char* const end = pos + str.size();
+    while( pos < end )
+    {
+        // memchr is vectorized by the C library
+        const void* found = std::memchr(pos, delimiter, size_t(end - pos));
+        const char* part_end = found ? static_cast<const char*>(found) : end;
+        func( StringView(pos, size_t(part_end - pos)) );
+        pos = part_end + 1;
+    }
+}
+
 template <typename Predicate>
 using enable_if = typename std::enable_if< Predicate::value >::type*;
 
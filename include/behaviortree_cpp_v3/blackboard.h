@@ -11,11 +11,16 @@
 
 #include "behaviortree_cpp_v3/basic_types.h"
 #include "behaviortree_cpp_v3/utils/safe_any.hpp"
+#include "behaviortree_cpp_v3/utils/key_table.h"
+#include "behaviortree_cpp_v3/utils/wakeup_signal.h"
 #include "behaviortree_cpp_v3/exceptions.h"
 
 namespace BT
 {
 
+template <typename T>
+class LockedConstRef;
+
 /**
  * @brief The Blackboard is the mechanism used by BehaviorTrees to exchange
  * typed data.
@@ -25,9 +30,32 @@ class Blackboard
   public:
     typedef std::shared_ptr<Blackboard> Ptr;
 
+    /// An entry is created once and never removed: a pointer to it
+    /// stays valid even if the Blackboard is destroyed.
+    /// Each entry has its own mutex, which must be locked to access value.
+    struct Entry{
+        Any value;
+        const PortInfo port_info;
+        mutable std::mutex mutex;
+        // Signaled when the value is written, see watchEntry().
+        // Protected by mutex.
+        std::vector<std::weak_ptr<WakeUpSignal>> watchers;
+
+        Entry( const PortInfo& info ):
+          port_info(info)
+        {}
+
+        Entry(Any&& other_any, const PortInfo& info):
+          value(std::move(other_any)),
+          port_info(info)
+        {}
+    };
+
   protected:
     // This is intentionally protected. Use Blackboard::create instead
-    Blackboard(Blackboard::Ptr parent): parent_bb_(parent)
+    Blackboard(Blackboard::Ptr parent):
+      shared_( parent ? parent->shared_ : std::make_shared<SharedState>() ),
+      parent_bb_(parent)
     {}
 
   public:
@@ -46,52 +74,44 @@ class Blackboard
      * @brief The method getAny allow the user to access directly the type
      * erased value.
      *
+     * Note that the value is not protected by Entry::mutex; if other threads
+     * may write the same entry, use get() or getEntry() instead.
+     *
      * @return the pointer or nullptr if it fails.
      */
     const Any* getAny(const std::string& key) const
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-
-        if( auto parent = parent_bb_.lock())
-        {
-            auto remapping_it = internal_to_external_.find(key);
-            if( remapping_it != internal_to_external_.end())
-            {
-                return parent->getAny( remapping_it->second );
-            }
-        }
-        auto it = storage_.find(key);
-        return ( it == storage_.end()) ? nullptr : &(it->second.value);
+        auto entry = getEntry(key);
+        return entry ? &(entry->value) : nullptr;
     }
 
     Any* getAny(const std::string& key)
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-
-        if( auto parent = parent_bb_.lock())
-        {
-            auto remapping_it = internal_to_external_.find(key);
-            if( remapping_it != internal_to_external_.end())
-            {
-                return parent->getAny( remapping_it->second );
-            }
-        }
-        auto it = storage_.find(key);
-        return ( it == storage_.end()) ? nullptr : &(it->second.value);
+        auto entry = getEntry(key);
+        return entry ? &(entry->value) : nullptr;
     }
 
+    /**
+     * @brief getEntry returns the entry with the given key, following the
+     * remapping of the subtrees, if any.
+     *
+     * @return the entry or nullptr if not found.
+     */
+    std::shared_ptr<Entry> getEntry(StringView key) const;
+
     /** Return true if the entry with the given key was found.
      *  Note that this method may throw an exception if the cast to T failed.
      */
     template <typename T>
     bool get(const std::string& key, T& value) const
     {
-        const Any* val = getAny(key);
-        if (val)
+        auto entry = getEntry(key);
+        if (entry)
         {
-            value = val->cast<T>();
+            std::unique_lock<std::mutex> lock(entry->mutex);
+            value = entry->value.cast<T>();
         }
-        return (bool)val;
+        return (bool)entry;
     }
 
     /**
@@ -100,10 +120,11 @@ class Blackboard
     template <typename T>
     T get(const std::string& key) const
     {
-        const Any* val = getAny(key);
-        if (val)
+        auto entry = getEntry(key);
+        if (entry)
         {
-            return val->cast<T>();
+            std::unique_lock<std::mutex> lock(entry->mutex);
+            return entry->value.cast<T>();
         }
         else
         {
@@ -112,104 +133,257 @@ class Blackboard
     }
 
 
-    /// Update the entry with the given key
+    /**
+     * @brief borrow gives read-only access to a value, without copying it.
+     * The entry is locked until the returned object is destroyed.
+     *
+     * Only custom types can be borrowed (numbers and strings are stored
+     * in a different form); throws if the entry is missing or is not a T.
+     */
+    template <typename T>
+    LockedConstRef<T> borrow(const std::string& key) const;
+
+    /// Update the entry with the given key.
+    /// The lock of the Blackboard is held only to find or create the entry.
     template <typename T>
     void set(const std::string& key, const T& value)
     {
-        std::unique_lock<std::mutex> lock(mutex_);
-        auto it = storage_.find(key);
-
-        if( auto parent = parent_bb_.lock())
+        auto entry = getOrCreateEntry(key);
+        try {
+            assignValue( *entry, value );
+        }
+        catch( LogicError& )
         {
-            auto remapping_it = internal_to_external_.find(key);
-            if( remapping_it != internal_to_external_.end())
-            {
-                const auto& remapped_key = remapping_it->second;
-                if( it == storage_.end() ) // virgin entry
-                {
-                    auto parent_info = parent->portInfo(remapped_key);
-                    if( parent_info )
-                    {
-                        storage_.insert( {key, Entry( *parent_info ) } );
-                    }
-                    else{
-                        storage_.insert( {key, Entry( PortInfo() ) } );
-                    }
-                }
-                parent->set( remapped_key, value );
-                return;
-            }
+            debugMessage();
+            throw;
         }
+    }
 
-        if( it != storage_.end() ) // already there. check the type
+    /// Same as set(), but the value is moved into the entry.
+    template <typename T,
+              typename = typename std::enable_if<!std::is_lvalue_reference<T>::value>::type>
+    void set(const std::string& key, T&& value)
+    {
+        auto entry = getOrCreateEntry(key);
+        try {
+            assignValue( *entry, std::move(value) );
+        }
+        catch( LogicError& )
         {
-            const PortInfo& port_info = it->second.port_info;
-            auto& previous_any = it->second.value;
-            const auto locked_type = port_info.type();
+            debugMessage();
+            throw;
+        }
+    }
 
-            Any temp(value);
+    /// Construct a T from args and move it into the entry with the given key.
+    template <typename T, typename... Args>
+    void emplace(const std::string& key, Args&&... args)
+    {
+        set( key, T( std::forward<Args>(args)... ) );
+    }
 
-            if( locked_type && locked_type != &typeid(T) && locked_type != &temp.type() )
+    /// Write the value of an existing entry, with the same type checking
+    /// of set(). Throws if the type is not compatible with Entry::port_info.
+    /// Entry::mutex is held only to swap the new value with the old one.
+    template <typename T>
+    static void assignValue(Entry& entry, T&& value)
+    {
+        const PortInfo& port_info = entry.port_info;
+        const auto locked_type = port_info.type();
+
+        // strings are never moved: value can still be parsed below
+        Any temp( std::forward<T>(value) );
+
+        if( locked_type && locked_type != &typeid(T) && locked_type != &temp.type() )
+        {
+            bool mismatching = true;
+            if( std::is_constructible<StringView, T>::value )
             {
-                bool mismatching = true;
-                if( std::is_constructible<StringView, T>::value )
+                Any any_from_string = port_info.parseString( value );
+                if( any_from_string.empty() == false)
                 {
-                    Any any_from_string = port_info.parseString( value );
-                    if( any_from_string.empty() == false)
-                    {
-                        mismatching = false;
-                        temp = std::move( any_from_string );
-                    }
+                    mismatching = false;
+                    temp = std::move( any_from_string );
                 }
+            }
 
-                if( mismatching )
+            if( mismatching )
+            {
+                throw LogicError( "Blackboard::set() failed: once declared, the type of a port shall not change. "
+                                 "Declared type [", demangle( locked_type ),
+                                 "] != current type [", demangle( typeid(T) ),"]" );
+            }
+        }
+        {
+            std::unique_lock<std::mutex> lock(entry.mutex);
+            std::swap( entry.value, temp );
+            for (const auto& watcher: entry.watchers)
+            {
+                if( auto signal = watcher.lock() )
                 {
-                    debugMessage();
-
-                    throw LogicError( "Blackboard::set() failed: once declared, the type of a port shall not change. "
-                                     "Declared type [", demangle( locked_type ),
-                                     "] != current type [", demangle( typeid(T) ),"]" );
+                    signal->emitSignal();
                 }
             }
-            previous_any = std::move(temp);
         }
-        else{ // create for the first time without any info
-            storage_.emplace( key, Entry( Any(value), PortInfo() ) );
-        }
-        return;
+        // the previous value is destroyed here, without holding the lock
     }
 
+    /**
+     * @brief watchEntry emits the signal every time the entry with the given
+     * key is written with set() or an output port. The entry is created if
+     * it doesn't exist. The Blackboard keeps only a weak reference to signal.
+     *
+     * Values modified in place through getAny() are not detected.
+     */
+    void watchEntry(const std::string& key, const std::shared_ptr<WakeUpSignal>& signal);
+
     void setPortInfo(std::string key, const PortInfo& info);
 
     const PortInfo *portInfo(const std::string& key);
 
+    /**
+     * @brief addSubtreeRemapping redirects the key "internal" of this
+     * Blackboard to the key "external" of the parent.
+     *
+     * The chain of remappings is resolved here, once: if the parent remaps
+     * "external" too, the key is redirected directly to its final owner.
+     * Therefore the remappings must be added top-down, from the root to the
+     * leaves, as XMLParser does: throws LogicError if "internal" was already
+     * used, by an entry of this Blackboard or by a remapping of a child.
+     */
     void addSubtreeRemapping(std::string internal, std::string external);
 
     void debugMessage() const;
 
   private:
 
-    struct Entry{
-        Any value;
-        const PortInfo port_info;
+    // Shared by a Blackboard and all its descendants (the Blackboards of the
+    // SubTrees): a key has the same KeyID in all of them.
+    // The mutex protects only the table, never held while locking others.
+    class SharedState
+    {
+      public:
+        KeyID intern(StringView key)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return keys_.intern(key);
+        }
 
-        Entry( const PortInfo& info ):
-          port_info(info)
-        {}
+        bool find(StringView key, KeyID& id) const
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return keys_.find(key, id);
+        }
 
-        Entry(Any&& other_any, const PortInfo& info):
-          value(std::move(other_any)),
-          port_info(info)
-        {}
+        std::string name(KeyID id) const
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return keys_.name(id);
+        }
+
+      private:
+        mutable std::mutex mutex_;
+        KeyTable keys_;
     };
 
-    mutable std::mutex mutex_;
-    std::unordered_map<std::string, Entry> storage_;
+    struct Remapping
+    {
+        // key in the parent
+        KeyID external_id;
+        // final Blackboard of the chain of remappings and key in it
+        std::weak_ptr<Blackboard> owner;
+        KeyID owner_id;
+    };
+
+    // Entry that will store the value of key, following the remapping.
+    // Create it if needed.
+    std::shared_ptr<Entry> getOrCreateEntry(StringView key);
+
+    // Slow path of getOrCreateEntry(): walk the chain of remappings one
+    // level at the time, creating the missing placeholders.
+    std::shared_ptr<Entry> createEntryChain(KeyID id, const Blackboard& owner, KeyID owner_id);
+
+    std::shared_ptr<SharedState> shared_;
     std::weak_ptr<Blackboard> parent_bb_;
-    std::unordered_map<std::string,std::string> internal_to_external_;
 
+    // Protects the maps below. A thread never holds the mutex of two
+    // Blackboards at the same time.
+    mutable std::mutex mutex_;
+    FlatIdMap<std::shared_ptr<Entry>> storage_;
+    FlatIdMap<Remapping> internal_to_external_;
+    // keys that the children remap to; the value is unused
+    FlatIdMap<uint8_t> remapped_by_children_;
+};
+
+
+/**
+ * @brief LockedConstRef is a read-only reference to the value of a
+ * Blackboard entry, that keeps the entry locked while it exists.
+ *
+ * Keep it short-lived: writers of the same entry are blocked until it is
+ * destroyed, and borrowing the same entry twice in one thread deadlocks.
+ */
+template <typename T>
+class LockedConstRef
+{
+  public:
+    LockedConstRef(): ptr_(nullptr)
+    {}
+
+    /// Lock the entry; the reference is empty if the entry doesn't contain a T.
+    explicit LockedConstRef(std::shared_ptr<const Blackboard::Entry> entry):
+      entry_( std::move(entry) ),
+      lock_( entry_->mutex ),
+      ptr_( entry_->value.template castPtr<T>() )
+    {
+        if( !ptr_ )
+        {
+            lock_.unlock();
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return ptr_ != nullptr;
+    }
+
+    const T* get() const
+    {
+        return ptr_;
+    }
+
+    const T& operator*() const
+    {
+        return *ptr_;
+    }
+
+    const T* operator->() const
+    {
+        return ptr_;
+    }
+
+  private:
+    std::shared_ptr<const Blackboard::Entry> entry_;
+    std::unique_lock<std::mutex> lock_;
+    const T* ptr_;
 };
 
+template <typename T>
+inline LockedConstRef<T> Blackboard::borrow(const std::string& key) const
+{
+    auto entry = getEntry(key);
+    if( !entry )
+    {
+        throw RuntimeError("Blackboard::borrow() error. Missing key [", key, "]");
+    }
+    LockedConstRef<T> ref(entry);
+    if( !ref )
+    {
+        throw RuntimeError("Blackboard::borrow() error. The entry [", key,
+                           "] doesn't contain a [", demangle( typeid(T) ), "]");
+    }
+    return ref;
+}
 
 } // end namespace
 
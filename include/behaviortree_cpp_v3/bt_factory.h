@@ -21,9 +21,13 @@
 #include <cstring>
 #include <algorithm>
 #include <set>
+#include <chrono>
 
 
 #include "behaviortree_cpp_v3/behavior_tree.h"
+#include "behaviortree_cpp_v3/utils/frame_pool.h"
+#include "behaviortree_cpp_v3/utils/node_arena.h"
+#include "behaviortree_cpp_v3/utils/wakeup_signal.h"
 
 namespace BT
 {
@@ -32,6 +36,35 @@ namespace BT
 typedef std::function<std::unique_ptr<TreeNode>(const std::string&, const NodeConfiguration&)>
 NodeBuilder;
 
+/// Same as NodeBuilder, but the node is constructed inside the memory of a NodeArena.
+/// The returned node is owned by the caller, that must invoke its destructor.
+typedef std::function<TreeNode*(NodeArena&, const std::string&, const NodeConfiguration&)>
+ArenaNodeBuilder;
+
+/**
+ * @brief TreeNodeRegistration contains everything that the factory knows
+ * about a registered ID, found with a single lookup.
+ * See BehaviorTreeFactory::registration().
+ */
+struct TreeNodeRegistration
+{
+    struct Port
+    {
+        std::string name;
+        PortInfo info;
+    };
+
+    TreeNodeManifest manifest;
+    NodeBuilder builder;
+    // empty if the node can't be constructed inside a NodeArena
+    ArenaNodeBuilder arena_builder;
+    // the ports of the manifest, sorted by name
+    std::vector<Port> ports;
+
+    /// Find a port without allocating memory; nullptr if not found.
+    const Port* findPort(const char* name) const;
+};
+
 constexpr const char* PLUGIN_SYMBOL = "BT_RegisterNodesFromPlugin";
 
 #ifndef BT_PLUGIN_EXPORT
@@ -74,6 +107,10 @@ See examples for more information about configuring CMake correctly
  * To tick the tree, simply call:
  *
  *    NodeStatus status = my_tree.root_node->executeTick();
+ *
+ * or, to tick it until it completes, only when something changed:
+ *
+ *    NodeStatus status = my_tree.tickWhileRunning();
  */
 struct Tree
 {
@@ -82,6 +119,19 @@ struct Tree
     std::vector<Blackboard::Ptr> blackboard_stack;
     std::unordered_map<std::string, TreeNodeManifest> manifests;
 
+    // Memory used by the nodes, if BehaviorTreeFactory::enableNodeArena() was used.
+    std::shared_ptr<NodeArena> arena;
+
+    // Not null if BehaviorTreeFactory::enableLazySubtrees() was used with an idle time.
+    std::shared_ptr<SubtreeEvictionPolicy> subtree_eviction;
+
+    // Shared with the nodes (NodeConfiguration::wake_up), see sleep().
+    std::shared_ptr<WakeUpSignal> wake_up;
+
+    // Shared with the nodes (NodeConfiguration::frame_pool). Not null only if
+    // the library is built with BT_CPP20_COROUTINES.
+    std::shared_ptr<FramePool> frame_pool;
+
     Tree(): root_node(nullptr) {}
 
     // non-copyable. Only movable
@@ -99,12 +149,230 @@ struct Tree
         nodes = std::move(other.nodes);
         blackboard_stack = std::move(other.blackboard_stack);
         manifests = std::move(other.manifests);
+        arena = std::move(other.arena);
+        subtree_eviction = std::move(other.subtree_eviction);
+        wake_up = std::move(other.wake_up);
+        frame_pool = std::move(other.frame_pool);
         return *this;
     }
 
     ~Tree();
 
     Blackboard::Ptr rootBlackboard();
+
+    /**
+     * @brief Destroy now the nodes of the lazy SubTrees that are idle, instead
+     * of waiting for the next tick of a lazy SubTree.
+     * Call it from the thread that ticks the tree.
+     *
+     * @return the number of SubTrees released.
+     */
+    size_t evictIdleSubtrees();
+
+    /**
+     * @brief sleep until something may change the result of the next tick:
+     * a node calls TreeNode::emitWakeUpSignal() (AsyncActionNode does it when
+     * tick() returns), a watched entry of the Blackboard is written (see
+     * watchBlackboardEntry()) or a deadline requested with
+     * TreeNode::requestWakeUp() expires.
+     *
+     * @return false if the timeout expired without any event.
+     */
+    bool sleep(std::chrono::steady_clock::duration timeout);
+
+    /// sleep() returns when the entry with the given key of rootBlackboard()
+    /// is written.
+    void watchBlackboardEntry(const std::string& key);
+
+    /**
+     * @brief Tick the root until it returns SUCCESS or FAILURE. After each
+     * RUNNING tick the thread sleeps until an event (see sleep()) or, at most,
+     * max_sleep.
+     *
+     * max_sleep bounds the latency of the nodes that change their result
+     * without emitting any event, e.g. a StatefulActionNode that polls a
+     * resource in onRunning(). If all of them emit events, it can be long.
+     */
+    NodeStatus tickWhileRunning(std::chrono::milliseconds max_sleep = std::chrono::milliseconds(10));
+};
+
+class XMLParser;
+class XMLDocumentCache;
+
+/**
+ * @brief A TreeBlueprint is a tree compiled once into a flat list of nodes,
+ * that can be instantiated many times.
+ *
+ * The XML is parsed, verified and resolved (builders, ports and remappings)
+ * only when the blueprint is created. instantiate() doesn't need the XML
+ * nor the factory: the builders are copied into the blueprint.
+ *
+ *    auto blueprint = factory.createBlueprintFromFile("tree.xml");
+ *    Tree tree_A = blueprint.instantiate();
+ *    Tree tree_B = blueprint.instantiate();
+ *
+ * A const TreeBlueprint can be used by multiple threads at the same time.
+ */
+class TreeBlueprint
+{
+  public:
+    TreeBlueprint():
+      def_( std::make_shared<Definition>() ),
+      use_node_arena_(false),
+      instantiation_threads_(1),
+      lazy_subtrees_(false),
+      subtree_idle_time_(0)
+    {}
+
+    /**
+     * @brief Create a new Tree. The Blackboards of the SubTrees are
+     * created too, as children of the given one.
+     *
+     * Throws if the type of a port isn't consistent with the one
+     * already declared in the blackboard.
+     */
+    Tree instantiate(const Blackboard::Ptr& blackboard = Blackboard::create()) const;
+
+    size_t nodesCount() const
+    {
+        return def_->nodes.size();
+    }
+
+    /// Number of Blackboards of a Tree, including the root one.
+    size_t blackboardsCount() const
+    {
+        return def_->blackboards.size();
+    }
+
+    /**
+     * @brief Binary form of the blueprint (Flatbuffers, see BT_blueprint.fbs),
+     * that can be loaded with BehaviorTreeFactory::createBlueprintFromBinary().
+     *
+     * Only the registration IDs of the nodes are stored: the builders and the
+     * manifests are taken from the factory that loads it.
+     */
+    std::vector<uint8_t> serialize() const;
+
+  private:
+    friend class XMLParser;
+    friend class BehaviorTreeFactory;
+
+    struct Builder
+    {
+        std::string ID;
+        NodeBuilder builder;
+        // empty if the node can't be stored in the NodeArena
+        ArenaNodeBuilder arena_builder;
+    };
+
+    // port remapped to the blackboard: the type is declared before
+    // the node is created.
+    struct PortDeclaration
+    {
+        std::string port_name;
+        std::string key;
+        PortInfo info;
+    };
+
+    struct NodeRecord
+    {
+        std::string instance_name;
+        // index in Definition::builders, -1 for the SubTrees referenced by their ID
+        int builder_index;
+        // if true, the next BlackboardRecord is instantiated with this node
+        bool subtree;
+        // index in Definition::nodes, -1 for the root
+        int parent_index;
+        // index in Definition::blackboards
+        size_t blackboard_index;
+        PortsRemapping input_ports;
+        PortsRemapping output_ports;
+        std::vector<PortDeclaration> port_declarations;
+        // literal input_ports converted by parseInputConstants()
+        std::unordered_map<std::string, Any> input_constants;
+
+        // Computed by Definition::computeSubtreeRanges(), for SubTrees only:
+        // the nodes of the SubTree are [this + 1, subtree_end) and its
+        // Blackboard is subtree_blackboard.
+        size_t subtree_end;
+        size_t subtree_blackboard;
+    };
+
+    // The Blackboard of a SubTree is created when its SubTree node is.
+    struct BlackboardRecord
+    {
+        size_t parent_index;
+        std::vector<std::pair<std::string, std::string>> remappings;
+    };
+
+    // Immutable once the blueprint is created: shared by the copies of the
+    // blueprint and by the lazy SubTrees.
+    struct Definition
+    {
+        // in the same order of Tree::nodes
+        std::vector<NodeRecord> nodes;
+        // in the same order of Tree::blackboard_stack. The first one is the
+        // Blackboard given to instantiate()
+        std::vector<BlackboardRecord> blackboards;
+        std::vector<Builder> builders;
+        std::unordered_map<std::string, TreeNodeManifest> manifests;
+        // copied to NodeConfiguration::async_executor
+        std::shared_ptr<ThreadPool> async_executor;
+
+        void computeSubtreeRanges();
+    };
+
+    std::shared_ptr<Definition> def_;
+    bool use_node_arena_;
+    unsigned instantiation_threads_;
+    bool lazy_subtrees_;
+    std::chrono::milliseconds subtree_idle_time_;
+
+    static void declarePorts(const NodeRecord& record, const Blackboard::Ptr& blackboard);
+
+    // Convert once the literal input_ports of the record, with the types
+    // declared in the registration. The values that can't be converted are
+    // skipped: getInput() will parse them again and report the error.
+    static void parseInputConstants(NodeRecord& record,
+                                    const TreeNodeRegistration& registration);
+
+    // The node gets the given UID.
+    static TreeNode::Ptr createNode(const Definition& def,
+                                    const NodeRecord& record,
+                                    uint16_t uid,
+                                    const Blackboard::Ptr& blackboard,
+                                    const std::shared_ptr<NodeArena>& arena,
+                                    const std::shared_ptr<WakeUpSignal>& wake_up,
+                                    const std::shared_ptr<FramePool>& frame_pool);
+
+    static Blackboard::Ptr createBlackboard(const Definition& def, size_t index,
+                                            const Blackboard::Ptr& parent);
+
+    // Create and link the nodes [first, last); nodes[i - first] is the node i.
+    // blackboards[k - first_blackboard] is the Blackboard of BlackboardRecord k:
+    // the first one must be given, the ones of the SubTrees are created here.
+    // If lazy, the children of the SubTrees are not created: they become lazy
+    // SubTrees and the corresponding elements of nodes and blackboards stay empty.
+    // The node i gets the UID first_uid + (i - first); the UIDs of the lazy
+    // SubTrees are part of the range, so that a rebuild reuses them.
+    static void createRange(const std::shared_ptr<const Definition>& def,
+                            size_t first, size_t last, size_t first_blackboard,
+                            uint16_t first_uid,
+                            std::vector<TreeNode::Ptr>& nodes,
+                            std::vector<Blackboard::Ptr>& blackboards,
+                            const std::shared_ptr<NodeArena>& arena,
+                            bool lazy,
+                            const std::shared_ptr<SubtreeEvictionPolicy>& eviction,
+                            const std::shared_ptr<WakeUpSignal>& wake_up,
+                            const std::shared_ptr<FramePool>& frame_pool);
+
+    // Same as createRange() for the whole tree, without lazy SubTrees,
+    // using instantiation_threads_.
+    void createNodesConcurrently(std::vector<TreeNode::Ptr>& nodes,
+                                 std::vector<Blackboard::Ptr>& blackboards,
+                                 const std::shared_ptr<NodeArena>& arena,
+                                 const std::shared_ptr<WakeUpSignal>& wake_up,
+                                 const std::shared_ptr<FramePool>& frame_pool) const;
 };
 
 /**
@@ -173,6 +441,23 @@ public:
      */
     void registerFromPlugin(const std::string &file_path);
 
+    /**
+     * @brief registerFromPluginManifest registers the nodes of a plugin using
+     * the manifest created by the tool bt3_plugin_manifest, without loading
+     * the plugin.
+     *
+     * The shared library is loaded, with lazy binding, only when one of its
+     * nodes is instantiated for the first time; the plugins that are never
+     * used are never loaded.
+     *
+     * Note that the manifest doesn't contain the C++ types of the ports:
+     * these ports don't set the type of their entries in the Blackboard.
+     *
+     * @param manifest_path path of the manifest. A relative path of the
+     *                      plugin, inside the manifest, is relative to it.
+     */
+    void registerFromPluginManifest(const std::string& manifest_path);
+
     /**
      * @brief instantiateTreeNode creates an instance of a previously registered TreeNode.
      *
@@ -184,6 +469,112 @@ public:
     std::unique_ptr<TreeNode> instantiateTreeNode(const std::string& name, const std::string &ID,
                                                   const NodeConfiguration& config) const;
 
+    /**
+     * @brief Same as above, but the node is constructed inside the arena, if an
+     * ArenaNodeBuilder is available for this ID. Otherwise, the regular NodeBuilder is used.
+     *
+     * The arena is kept alive until the returned node is destroyed.
+     */
+    TreeNode::Ptr instantiateTreeNode(const std::string& name, const std::string &ID,
+                                      const NodeConfiguration& config,
+                                      const std::shared_ptr<NodeArena>& arena) const;
+
+    /// Add an ArenaNodeBuilder to an ID that was already registered.
+    void registerArenaBuilder(const std::string& ID, const ArenaNodeBuilder& builder);
+
+    /**
+     * @brief enableNodeArena: when true, the trees created by this factory
+     * store their nodes in a few contiguous blocks of memory owned by Tree::arena,
+     * instead of allocating each one of them separately. False by default.
+     *
+     * Only the nodes registered with registerNodeType() (or registerArenaBuilder())
+     * are stored in the arena; the others fall back to their NodeBuilder.
+     */
+    void enableNodeArena(bool enable);
+
+    bool nodeArenaEnabled() const;
+
+    /**
+     * @brief setInstantiationThreads: when larger than 1, the nodes of the
+     * SubTrees are created concurrently, using up to this number of threads.
+     * Default is 1.
+     *
+     * Useful when the constructors of the nodes are expensive (connections
+     * to servers, loading of maps, etc.). The constructors of the nodes of
+     * the same SubTree are still called sequentially, in order, but different
+     * SubTrees run in parallel: the constructors must be thread-safe.
+     *
+     * The result is the same of a serial instantiation: Tree::nodes, the
+     * UIDs and the children have the same order. The only difference is
+     * that the types of the ports are declared in the Blackboards before
+     * any node is created.
+     */
+    void setInstantiationThreads(unsigned threads);
+
+    unsigned instantiationThreads() const;
+
+    /**
+     * @brief enableLazySubtrees: when true, the nodes of a SubTree are created
+     * when the SubTree is ticked for the first time, instead of when the tree
+     * is. False by default.
+     *
+     * It reduces the startup time and the memory of large trees in which only
+     * a few branches are executed. If idle_time is larger than zero, the nodes
+     * of a SubTree that was not ticked for that time are destroyed, and
+     * created again at the next tick (see Tree::evictIdleSubtrees()).
+     *
+     * Note that:
+     * - errors in the ports of a SubTree are reported when it is ticked;
+     * - Tree::nodes and Tree::blackboard_stack contain only the nodes and
+     *   Blackboards created with the tree: loggers and visitors don't see
+     *   the nodes of the lazy SubTrees created later;
+     * - the nodes of the lazy SubTrees are not stored in the NodeArena and
+     *   they are always created by a single thread.
+     */
+    void enableLazySubtrees(bool enable,
+                            std::chrono::milliseconds idle_time = std::chrono::milliseconds(0));
+
+    bool lazySubtreesEnabled() const;
+
+    std::chrono::milliseconds subtreeIdleTime() const;
+
+    /**
+     * @brief setXMLDocumentCache: the files loaded by createTreeFromFile(),
+     * createBlueprintFromFile() and their <include>s are taken from this
+     * cache, if they didn't change since they were parsed. Null by default:
+     * the files are parsed by every call.
+     *
+     * Use XMLDocumentCache::global() to parse each file once per process.
+     */
+    void setXMLDocumentCache(std::shared_ptr<XMLDocumentCache> cache);
+
+    const std::shared_ptr<XMLDocumentCache>& xmlDocumentCache() const;
+
+    /**
+     * @brief setAsyncExecutor: the AsyncActionNodes of the trees created by
+     * this factory execute tick() in this ThreadPool, instead of starting a
+     * thread each. Null by default.
+     *
+     * The same ThreadPool can be shared by many factories and trees: it is
+     * kept alive by the nodes that use it. Note that a tick() that never
+     * returns keeps one of its threads busy forever.
+     */
+    void setAsyncExecutor(std::shared_ptr<ThreadPool> executor);
+
+    const std::shared_ptr<ThreadPool>& asyncExecutor() const;
+
+    /**
+     * @brief enableXMLVerification: when false, the XML is not checked by
+     * VerifyXML() before the tree is created. True by default.
+     *
+     * Disable it only for files that were already validated, for instance
+     * the same file loaded many times: errors in an unverified XML may be
+     * reported later, with less informative messages.
+     */
+    void enableXMLVerification(bool enable);
+
+    bool xmlVerificationEnabled() const;
+
     /** registerNodeType is the method to use to register your custom TreeNode.
      *
      *  It accepts only classed derived from either ActionNodeBase, DecoratorNode,
@@ -229,9 +620,15 @@ public:
     /// All the builders. Made available mostly for debug purposes.
     const std::unordered_map<std::string, NodeBuilder>& builders() const;
 
+    /// The builders added with registerArenaBuilder().
+    const std::unordered_map<std::string, ArenaNodeBuilder>& arenaBuilders() const;
+
     /// Manifests of all the registered TreeNodes.
     const std::unordered_map<std::string, TreeNodeManifest>& manifests() const;
 
+    /// Builders and manifest of a registered ID; nullptr if not registered.
+    const TreeNodeRegistration* registration(const std::string& ID) const;
+
     /// List of builtin IDs.
     const std::set<std::string>& builtinNodes() const;
 
@@ -241,6 +638,26 @@ public:
     Tree createTreeFromFile(const std::string& file_path,
                             Blackboard::Ptr blackboard = Blackboard::create());
 
+    /// Compile the XML once, to create many identical Trees with
+    /// TreeBlueprint::instantiate().
+    TreeBlueprint createBlueprintFromText(const std::string& text) const;
+
+    TreeBlueprint createBlueprintFromFile(const std::string& file_path) const;
+
+    /**
+     * @brief Load a blueprint written by TreeBlueprint::serialize()
+     * (or by the tool bt3_compile), without parsing any XML.
+     *
+     * All the IDs used in the blueprint must be registered in this factory.
+     */
+    TreeBlueprint createBlueprintFromBinary(const uint8_t* data, size_t size) const;
+
+    /// Same as createBlueprintFromBinary(), but the file is mapped in memory.
+    TreeBlueprint createBlueprintFromBinaryFile(const std::string& file_path) const;
+
+    Tree createTreeFromBinaryFile(const std::string& file_path,
+                                  Blackboard::Ptr blackboard = Blackboard::create());
+
     template <typename T> static
     TreeNodeManifest buildManifest(const std::string& ID)
     {
@@ -249,8 +666,18 @@ public:
 
 private:
     std::unordered_map<std::string, NodeBuilder> builders_;
+    std::unordered_map<std::string, ArenaNodeBuilder> arena_builders_;
     std::unordered_map<std::string, TreeNodeManifest> manifests_;
+    // the same content of the three maps above, in a single record for each ID
+    std::unordered_map<std::string, TreeNodeRegistration> registrations_;
     std::set<std::string> builtin_IDs_;
+    bool use_node_arena_;
+    bool verify_xml_;
+    unsigned instantiation_threads_;
+    bool lazy_subtrees_;
+    std::chrono::milliseconds subtree_idle_time_;
+    std::shared_ptr<XMLDocumentCache> document_cache_;
+    std::shared_ptr<ThreadPool> async_executor_;
 
     // template specialization = SFINAE + black magic
 
@@ -266,44 +693,46 @@ private:
     {
         NodeBuilder builder = getBuilder<T>();
         registerBuilder( buildManifest<T>(ID), builder);
+        registerArenaBuilder( ID, getArenaBuilder<T>() );
+    }
+
+    // The constructor with NodeConfiguration is preferred even if the node has
+    // no ports: the configuration carries the executor and the wake-up signal too.
+    template <typename T> static
+    NodeBuilder getBuilder(typename std::enable_if<has_params_constructor<T>::value >::type* = nullptr)
+    {
+        return [](const std::string& name, const NodeConfiguration& params)
+        {
+            return std::unique_ptr<TreeNode>(new T(name, params));
+        };
     }
 
     template <typename T> static
     NodeBuilder getBuilder(typename std::enable_if<has_default_constructor<T>::value &&
-                                                   has_params_constructor<T>::value >::type* = nullptr)
+                                                   !has_params_constructor<T>::value >::type* = nullptr)
     {
-        return [](const std::string& name, const NodeConfiguration& config)
+        return [](const std::string& name, const NodeConfiguration&)
         {
-            //TODO FIXME
-
-            // Special case. Use default constructor if parameters are empty
-            if( config.input_ports.empty() &&
-                config.output_ports.empty() &&
-                has_default_constructor<T>::value)
-            {
-                return std::make_unique<T>(name);
-            }
-            return std::make_unique<T>(name, config);
+            return std::unique_ptr<TreeNode>(new T(name));
         };
     }
 
     template <typename T> static
-    NodeBuilder getBuilder(typename std::enable_if<!has_default_constructor<T>::value &&
-                                                   has_params_constructor<T>::value >::type* = nullptr)
+    ArenaNodeBuilder getArenaBuilder(typename std::enable_if<has_params_constructor<T>::value >::type* = nullptr)
     {
-        return [](const std::string& name, const NodeConfiguration& params)
+        return [](NodeArena& arena, const std::string& name, const NodeConfiguration& params) -> TreeNode*
         {
-            return std::unique_ptr<TreeNode>(new T(name, params));
+            return arena.create<T>(name, params);
         };
     }
 
     template <typename T> static
-    NodeBuilder getBuilder(typename std::enable_if<has_default_constructor<T>::value &&
-                                                   !has_params_constructor<T>::value >::type* = nullptr)
+    ArenaNodeBuilder getArenaBuilder(typename std::enable_if<has_default_constructor<T>::value &&
+                                                             !has_params_constructor<T>::value >::type* = nullptr)
     {
-        return [](const std::string& name, const NodeConfiguration&)
+        return [](NodeArena& arena, const std::string& name, const NodeConfiguration&) -> TreeNode*
         {
-            return std::unique_ptr<TreeNode>(new T(name));
+            return arena.create<T>(name);
         };
     }
     // clang-format on
@@ -1,17 +1,67 @@
 #ifndef DECORATOR_SUBTREE_NODE_H
 #define DECORATOR_SUBTREE_NODE_H
 
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <vector>
 #include "behaviortree_cpp_v3/decorator_node.h"
 
 namespace BT
 {
 
+class SubtreeEvictionPolicy;
+
 class DecoratorSubtreeNode : public DecoratorNode
 {
   public:
     DecoratorSubtreeNode(const std::string& name);
 
-    virtual ~DecoratorSubtreeNode() override = default;
+    virtual ~DecoratorSubtreeNode() override;
+
+    /// Nodes and Blackboards of a lazy SubTree. The first node is the child.
+    struct LazyContent
+    {
+        std::vector<TreeNode::Ptr> nodes;
+        std::vector<Blackboard::Ptr> blackboards;
+    };
+
+    typedef std::function<LazyContent()> LazyBuilder;
+
+    /**
+     * @brief setLazyBuilder makes this a lazy SubTree: its nodes are created
+     * by builder when it is ticked for the first time.
+     *
+     * If eviction is not null, the nodes may be destroyed when the SubTree
+     * is idle and they are created again at the next tick.
+     */
+    void setLazyBuilder(LazyBuilder builder,
+                        std::shared_ptr<SubtreeEvictionPolicy> eviction = {});
+
+    bool isLazy() const
+    {
+        return bool(lazy_builder_);
+    }
+
+    /// False if this is a lazy SubTree whose nodes don't exist at the moment.
+    bool isInstantiated() const
+    {
+        return child_node_ != nullptr;
+    }
+
+    /// The nodes of a lazy SubTree, if instantiated.
+    const std::vector<TreeNode::Ptr>& lazyNodes() const
+    {
+        return lazy_content_.nodes;
+    }
+
+    /**
+     * @brief Destroy the nodes of a lazy SubTree; they will be created again
+     * at the next tick. Return false if the SubTree is not lazy or is RUNNING.
+     */
+    bool releaseLazyContent();
+
+    virtual void halt() override;
 
   private:
     virtual BT::NodeStatus tick() override;
@@ -20,8 +70,57 @@ class DecoratorSubtreeNode : public DecoratorNode
     {
         return NodeType::SUBTREE;
     }
+
+    friend class SubtreeEvictionPolicy;
+
+    LazyBuilder lazy_builder_;
+    LazyContent lazy_content_;
+    std::shared_ptr<SubtreeEvictionPolicy> eviction_;
+    std::chrono::steady_clock::time_point last_tick_;
 };
 
+/**
+ * @brief SubtreeEvictionPolicy destroys the nodes of the lazy SubTrees that
+ * were not ticked for a given time, to release their memory.
+ *
+ * It is shared by all the lazy SubTrees of a Tree and it is checked when
+ * any of them is ticked. evictIdleSubtrees() can also be called directly,
+ * but only by the thread that ticks the tree.
+ */
+class SubtreeEvictionPolicy
+{
+  public:
+    explicit SubtreeEvictionPolicy(std::chrono::milliseconds idle_time);
+
+    std::chrono::milliseconds idleTime() const
+    {
+        return idle_time_;
+    }
+
+    /// Release the idle SubTrees. Return how many of them were released.
+    size_t evictIdleSubtrees();
+
+    /// Number of lazy SubTrees whose nodes exist at the moment.
+    size_t instantiatedCount() const
+    {
+        return subtrees_.size();
+    }
+
+  private:
+    friend class DecoratorSubtreeNode;
+
+    // called by the ticks of the lazy SubTrees
+    void periodicCheck(std::chrono::steady_clock::time_point now);
+
+    void add(DecoratorSubtreeNode* subtree);
+
+    void remove(DecoratorSubtreeNode* subtree);
+
+    std::chrono::milliseconds idle_time_;
+    std::chrono::steady_clock::time_point last_check_;
+    // the instantiated lazy SubTrees
+    std::vector<DecoratorSubtreeNode*> subtrees_;
+};
 
 }
 
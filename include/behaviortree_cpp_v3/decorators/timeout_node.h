@@ -3,7 +3,7 @@
 
 #include "behaviortree_cpp_v3/decorator_node.h"
 #include <atomic>
-#include "timer_queue.h"
+#include "behaviortree_cpp_v3/utils/timer_service.h"
 
 namespace BT
 {
@@ -14,6 +14,11 @@ namespace BT
  *
  * If timeout is reached it returns FAILURE.
  *
+ * The timers of all the TimeoutNodes are executed by TimerService::global(),
+ * in a single thread. The timer only marks the node as expired and wakes up
+ * Tree::sleep(): the child is halted by the next tick, in the thread that
+ * ticks the tree. Therefore a slow halt() never delays the other timeouts.
+ *
  * Example:
  *
  * <Timeout msec="5000">
@@ -29,9 +34,11 @@ class TimeoutNode : public DecoratorNode
 
     ~TimeoutNode() override
     {
-        timer_.cancelAll();
+        timer_service_->cancel(timer_id_);
     }
 
+    void halt() override;
+
     static PortsList providedPorts()
     {
         return { InputPort<unsigned>("msec", "After a certain amount of time, "
@@ -39,17 +46,16 @@ class TimeoutNode : public DecoratorNode
     }
 
   private:
-    TimerQueue timer_ ;
+    std::shared_ptr<TimerService> timer_service_;
 
     virtual BT::NodeStatus tick() override;
 
-    std::atomic<bool> child_halted_;
+    std::atomic<bool> timed_out_;
     uint64_t timer_id_;
 
     unsigned msec_;
     bool read_parameter_from_ports_;
     bool timeout_started_;
-    std::mutex timeout_mutex_;
 };
 }
 
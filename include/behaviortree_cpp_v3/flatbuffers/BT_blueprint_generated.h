@@ -0,0 +1,352 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BTBLUEPRINT_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_BTBLUEPRINT_SERIALIZATION_H_
+
+#include "behaviortree_cpp_v3/flatbuffers/flatbuffers.h"
+
+#include "BT_logger_generated.h"
+
+namespace Serialization {
+
+struct BlueprintNode;
+
+struct BlueprintBlackboard;
+
+struct Blueprint;
+
+struct BlueprintNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_INSTANCE_NAME = 4,
+    VT_BUILDER_INDEX = 6,
+    VT_PARENT_INDEX = 8,
+    VT_BLACKBOARD_INDEX = 10,
+    VT_SUBTREE = 12,
+    VT_INPUT_PORTS = 14,
+    VT_OUTPUT_PORTS = 16,
+    VT_DECLARED_PORTS = 18
+  };
+  const flatbuffers::String *instance_name() const {
+    return GetPointer<const flatbuffers::String *>(VT_INSTANCE_NAME);
+  }
+  int32_t builder_index() const {
+    return GetField<int32_t>(VT_BUILDER_INDEX, -1);
+  }
+  int32_t parent_index() const {
+    return GetField<int32_t>(VT_PARENT_INDEX, -1);
+  }
+  uint32_t blackboard_index() const {
+    return GetField<uint32_t>(VT_BLACKBOARD_INDEX, 0);
+  }
+  bool subtree() const {
+    return GetField<uint8_t>(VT_SUBTREE, 0) != 0;
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *input_ports() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *>(VT_INPUT_PORTS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *output_ports() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *>(VT_OUTPUT_PORTS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *declared_ports() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *>(VT_DECLARED_PORTS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_INSTANCE_NAME) &&
+           verifier.VerifyString(instance_name()) &&
+           VerifyField<int32_t>(verifier, VT_BUILDER_INDEX) &&
+           VerifyField<int32_t>(verifier, VT_PARENT_INDEX) &&
+           VerifyField<uint32_t>(verifier, VT_BLACKBOARD_INDEX) &&
+           VerifyField<uint8_t>(verifier, VT_SUBTREE) &&
+           VerifyOffset(verifier, VT_INPUT_PORTS) &&
+           verifier.VerifyVector(input_ports()) &&
+           verifier.VerifyVectorOfTables(input_ports()) &&
+           VerifyOffset(verifier, VT_OUTPUT_PORTS) &&
+           verifier.VerifyVector(output_ports()) &&
+           verifier.VerifyVectorOfTables(output_ports()) &&
+           VerifyOffset(verifier, VT_DECLARED_PORTS) &&
+           verifier.VerifyVector(declared_ports()) &&
+           verifier.VerifyVectorOfTables(declared_ports()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BlueprintNodeBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_instance_name(flatbuffers::Offset<flatbuffers::String> instance_name) {
+    fbb_.AddOffset(BlueprintNode::VT_INSTANCE_NAME, instance_name);
+  }
+  void add_builder_index(int32_t builder_index) {
+    fbb_.AddElement<int32_t>(BlueprintNode::VT_BUILDER_INDEX, builder_index, -1);
+  }
+  void add_parent_index(int32_t parent_index) {
+    fbb_.AddElement<int32_t>(BlueprintNode::VT_PARENT_INDEX, parent_index, -1);
+  }
+  void add_blackboard_index(uint32_t blackboard_index) {
+    fbb_.AddElement<uint32_t>(BlueprintNode::VT_BLACKBOARD_INDEX, blackboard_index, 0);
+  }
+  void add_subtree(bool subtree) {
+    fbb_.AddElement<uint8_t>(BlueprintNode::VT_SUBTREE, static_cast<uint8_t>(subtree), 0);
+  }
+  void add_input_ports(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> input_ports) {
+    fbb_.AddOffset(BlueprintNode::VT_INPUT_PORTS, input_ports);
+  }
+  void add_output_ports(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> output_ports) {
+    fbb_.AddOffset(BlueprintNode::VT_OUTPUT_PORTS, output_ports);
+  }
+  void add_declared_ports(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> declared_ports) {
+    fbb_.AddOffset(BlueprintNode::VT_DECLARED_PORTS, declared_ports);
+  }
+  explicit BlueprintNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  BlueprintNodeBuilder &operator=(const BlueprintNodeBuilder &);
+  flatbuffers::Offset<BlueprintNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<BlueprintNode>(end);
+    fbb_.Required(o, BlueprintNode::VT_INSTANCE_NAME);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<BlueprintNode> CreateBlueprintNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> instance_name = 0,
+    int32_t builder_index = -1,
+    int32_t parent_index = -1,
+    uint32_t blackboard_index = 0,
+    bool subtree = false,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> input_ports = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> output_ports = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> declared_ports = 0) {
+  BlueprintNodeBuilder builder_(_fbb);
+  builder_.add_declared_ports(declared_ports);
+  builder_.add_output_ports(output_ports);
+  builder_.add_input_ports(input_ports);
+  builder_.add_blackboard_index(blackboard_index);
+  builder_.add_parent_index(parent_index);
+  builder_.add_builder_index(builder_index);
+  builder_.add_instance_name(instance_name);
+  builder_.add_subtree(subtree);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<BlueprintNode> CreateBlueprintNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *instance_name = nullptr,
+    int32_t builder_index = -1,
+    int32_t parent_index = -1,
+    uint32_t blackboard_index = 0,
+    bool subtree = false,
+    const std::vector<flatbuffers::Offset<PortConfig>> *input_ports = nullptr,
+    const std::vector<flatbuffers::Offset<PortConfig>> *output_ports = nullptr,
+    const std::vector<flatbuffers::Offset<PortConfig>> *declared_ports = nullptr) {
+  auto instance_name__ = instance_name ? _fbb.CreateString(instance_name) : 0;
+  auto input_ports__ = input_ports ? _fbb.CreateVector<flatbuffers::Offset<PortConfig>>(*input_ports) : 0;
+  auto output_ports__ = output_ports ? _fbb.CreateVector<flatbuffers::Offset<PortConfig>>(*output_ports) : 0;
+  auto declared_ports__ = declared_ports ? _fbb.CreateVector<flatbuffers::Offset<PortConfig>>(*declared_ports) : 0;
+  return Serialization::CreateBlueprintNode(
+      _fbb,
+      instance_name__,
+      builder_index,
+      parent_index,
+      blackboard_index,
+      subtree,
+      input_ports__,
+      output_ports__,
+      declared_ports__);
+}
+
+struct BlueprintBlackboard FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PARENT_INDEX = 4,
+    VT_REMAPPINGS = 6
+  };
+  uint32_t parent_index() const {
+    return GetField<uint32_t>(VT_PARENT_INDEX, 0);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *remappings() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<PortConfig>> *>(VT_REMAPPINGS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_PARENT_INDEX) &&
+           VerifyOffset(verifier, VT_REMAPPINGS) &&
+           verifier.VerifyVector(remappings()) &&
+           verifier.VerifyVectorOfTables(remappings()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BlueprintBlackboardBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_parent_index(uint32_t parent_index) {
+    fbb_.AddElement<uint32_t>(BlueprintBlackboard::VT_PARENT_INDEX, parent_index, 0);
+  }
+  void add_remappings(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> remappings) {
+    fbb_.AddOffset(BlueprintBlackboard::VT_REMAPPINGS, remappings);
+  }
+  explicit BlueprintBlackboardBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  BlueprintBlackboardBuilder &operator=(const BlueprintBlackboardBuilder &);
+  flatbuffers::Offset<BlueprintBlackboard> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<BlueprintBlackboard>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<BlueprintBlackboard> CreateBlueprintBlackboard(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t parent_index = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<PortConfig>>> remappings = 0) {
+  BlueprintBlackboardBuilder builder_(_fbb);
+  builder_.add_remappings(remappings);
+  builder_.add_parent_index(parent_index);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<BlueprintBlackboard> CreateBlueprintBlackboardDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t parent_index = 0,
+    const std::vector<flatbuffers::Offset<PortConfig>> *remappings = nullptr) {
+  auto remappings__ = remappings ? _fbb.CreateVector<flatbuffers::Offset<PortConfig>>(*remappings) : 0;
+  return Serialization::CreateBlueprintBlackboard(
+      _fbb,
+      parent_index,
+      remappings__);
+}
+
+struct Blueprint FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_REGISTRATION_NAMES = 4,
+    VT_NODES = 6,
+    VT_BLACKBOARDS = 8
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *registration_names() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_REGISTRATION_NAMES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<BlueprintNode>> *nodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<BlueprintNode>> *>(VT_NODES);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<BlueprintBlackboard>> *blackboards() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<BlueprintBlackboard>> *>(VT_BLACKBOARDS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_REGISTRATION_NAMES) &&
+           verifier.VerifyVector(registration_names()) &&
+           verifier.VerifyVectorOfStrings(registration_names()) &&
+           VerifyOffset(verifier, VT_NODES) &&
+           verifier.VerifyVector(nodes()) &&
+           verifier.VerifyVectorOfTables(nodes()) &&
+           VerifyOffset(verifier, VT_BLACKBOARDS) &&
+           verifier.VerifyVector(blackboards()) &&
+           verifier.VerifyVectorOfTables(blackboards()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BlueprintBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_registration_names(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> registration_names) {
+    fbb_.AddOffset(Blueprint::VT_REGISTRATION_NAMES, registration_names);
+  }
+  void add_nodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<BlueprintNode>>> nodes) {
+    fbb_.AddOffset(Blueprint::VT_NODES, nodes);
+  }
+  void add_blackboards(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<BlueprintBlackboard>>> blackboards) {
+    fbb_.AddOffset(Blueprint::VT_BLACKBOARDS, blackboards);
+  }
+  explicit BlueprintBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  BlueprintBuilder &operator=(const BlueprintBuilder &);
+  flatbuffers::Offset<Blueprint> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Blueprint>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Blueprint> CreateBlueprint(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> registration_names = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<BlueprintNode>>> nodes = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<BlueprintBlackboard>>> blackboards = 0) {
+  BlueprintBuilder builder_(_fbb);
+  builder_.add_blackboards(blackboards);
+  builder_.add_nodes(nodes);
+  builder_.add_registration_names(registration_names);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Blueprint> CreateBlueprintDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *registration_names = nullptr,
+    const std::vector<flatbuffers::Offset<BlueprintNode>> *nodes = nullptr,
+    const std::vector<flatbuffers::Offset<BlueprintBlackboard>> *blackboards = nullptr) {
+  auto registration_names__ = registration_names ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*registration_names) : 0;
+  auto nodes__ = nodes ? _fbb.CreateVector<flatbuffers::Offset<BlueprintNode>>(*nodes) : 0;
+  auto blackboards__ = blackboards ? _fbb.CreateVector<flatbuffers::Offset<BlueprintBlackboard>>(*blackboards) : 0;
+  return Serialization::CreateBlueprint(
+      _fbb,
+      registration_names__,
+      nodes__,
+      blackboards__);
+}
+
+inline const Serialization::Blueprint *GetBlueprint(const void *buf) {
+  return flatbuffers::GetRoot<Serialization::Blueprint>(buf);
+}
+
+inline const Serialization::Blueprint *GetSizePrefixedBlueprint(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<Serialization::Blueprint>(buf);
+}
+
+inline const char *BlueprintIdentifier() {
+  return "BT3B";
+}
+
+inline bool BlueprintBufferHasIdentifier(const void *buf) {
+  return flatbuffers::BufferHasIdentifier(
+      buf, BlueprintIdentifier());
+}
+
+inline bool VerifyBlueprintBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<Serialization::Blueprint>(BlueprintIdentifier());
+}
+
+inline bool VerifySizePrefixedBlueprintBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<Serialization::Blueprint>(BlueprintIdentifier());
+}
+
+inline const char *BlueprintExtension() {
+  return "btb";
+}
+
+inline void FinishBlueprintBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<Serialization::Blueprint> root) {
+  fbb.Finish(root, BlueprintIdentifier());
+}
+
+inline void FinishSizePrefixedBlueprintBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<Serialization::Blueprint> root) {
+  fbb.FinishSizePrefixed(root, BlueprintIdentifier());
+}
+
+}  // namespace Serialization
+
+#endif  // FLATBUFFERS_GENERATED_BTBLUEPRINT_SERIALIZATION_H_
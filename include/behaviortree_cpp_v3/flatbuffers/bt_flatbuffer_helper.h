@@ -77,8 +77,10 @@ inline void CreateFlatbuffersBehaviorTree(flatbuffers::FlatBufferBuilder& builde
         }
         else if (auto decorator = dynamic_cast<BT::DecoratorNode*>(node))
         {
-            const auto& child = decorator->child();
-            children_uid.push_back(child->UID());
+            if (const auto& child = decorator->child())
+            {
+                children_uid.push_back(child->UID());
+            }
         }
 
         std::vector<flatbuffers::Offset<Serialization::PortConfig>> ports;
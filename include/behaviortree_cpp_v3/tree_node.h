@@ -14,6 +14,8 @@
 #ifndef BEHAVIORTREECORE_TREENODE_H
 #define BEHAVIORTREECORE_TREENODE_H
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include "behaviortree_cpp_v3/utils/signal.h"
@@ -38,6 +40,10 @@ struct TreeNodeManifest
 
 typedef std::unordered_map<std::string, std::string> PortsRemapping;
 
+class ThreadPool;
+class WakeUpSignal;
+class FramePool;
+
 struct NodeConfiguration
 {
     NodeConfiguration()
@@ -47,6 +53,79 @@ struct NodeConfiguration
     Blackboard::Ptr blackboard;
     PortsRemapping input_ports;
     PortsRemapping output_ports;
+    // Values of the literal input_ports, already converted to the type
+    // declared by the port. Filled when the tree is compiled.
+    std::unordered_map<std::string, Any> input_constants;
+    // Executes tick() of the AsyncActionNodes. If null, each of them
+    // starts its own thread.
+    std::shared_ptr<ThreadPool> async_executor;
+    // Wakes up the thread that ticks the tree, see Tree::sleep().
+    // Null if the node is not part of a Tree.
+    std::shared_ptr<WakeUpSignal> wake_up;
+    // Allocates the frames of the StacklessCoroActionNodes of the Tree.
+    // If null, they are allocated with operator new.
+    std::shared_ptr<FramePool> frame_pool;
+};
+
+/**
+ * @brief PortHandle is a port resolved once, usually in the constructor of
+ * the node (see TreeNode::getInputHandle() and TreeNode::getOutputHandle()).
+ *
+ * It refers directly to the entry of the Blackboard or, if the port is a
+ * literal, to its value already converted to T. Reading or writing it doesn't
+ * require any lookup of the remapping or of the Blackboard.
+ *
+ * Accesses to the entry are protected by Blackboard::Entry::mutex, but
+ * the PortHandle itself should not be shared between threads.
+ */
+template <typename T>
+class PortHandle
+{
+  public:
+    PortHandle() = default;
+
+    /// Same as TreeNode::getInput()
+    Result get(T& destination) const;
+
+    Optional<T> get() const
+    {
+        T out;
+        auto res = get(out);
+        return (res) ? Optional<T>(out) : nonstd::make_unexpected(res.error());
+    }
+
+    /// Same as TreeNode::setOutput()
+    Result set(const T& value);
+
+    /// Same as set(), but the value is moved into the entry.
+    Result set(T&& value);
+
+    /// Read-only reference to the value in the Blackboard, without any copy.
+    /// Fails if the port contains a literal.
+    Result borrow(LockedConstRef<T>& destination) const;
+
+    /// True if the port contains a literal and not a Blackboard entry.
+    bool isConstant() const
+    {
+        return constant_ != nullptr;
+    }
+
+  private:
+    friend class TreeNode;
+
+    template <typename U>
+    Result write(U&& value);
+
+    // Read the value of entry, that may be null, into destination.
+    static Result readEntry(const Blackboard::Entry* entry, T& destination,
+                            StringView port_name, StringView key);
+
+    std::string port_name_;
+    std::string key_;
+    Blackboard::Ptr blackboard_;
+    mutable std::shared_ptr<Blackboard::Entry> entry_;
+    std::shared_ptr<const T> constant_;
+    std::string error_;
 };
 
 /// Abstract base class for Behavior Tree Nodes
@@ -89,6 +168,14 @@ class TreeNode
     /// either RUNNING, FAILURE or SUCCESS.
     BT::NodeStatus waitValidStatus();
 
+    /// Wake up Tree::sleep(): the next tick may have a different result.
+    /// Async nodes call it when they finish. Thread-safe.
+    void emitWakeUpSignal() const;
+
+    /// Ask Tree::sleep() to return after the given delay, at the latest.
+    /// Useful for nodes that poll something while RUNNING. Thread-safe.
+    void requestWakeUp(std::chrono::steady_clock::duration delay) const;
+
     virtual NodeType type() const = 0;
 
     using StatusChangeSignal = Signal<TimePoint, const TreeNode&, NodeStatus, NodeStatus>;
@@ -137,9 +224,35 @@ class TreeNode
         return (res) ? Optional<T>(out) : nonstd::make_unexpected(res.error());
     }
 
+    /** Read an input port without copying it: destination keeps the
+     * Blackboard entry locked until it is destroyed (see LockedConstRef).
+     * Fails if the port contains a literal or the entry is not a T.
+     */
+    template <typename T>
+    Result getInput(const std::string& key, LockedConstRef<T>& destination) const;
+
     template <typename T>
     Result setOutput(const std::string& key, const T& value);
 
+    /// Same as setOutput(), but the value is moved into the Blackboard.
+    template <typename T,
+              typename = typename std::enable_if<!std::is_lvalue_reference<T>::value>::type>
+    Result setOutput(const std::string& key, T&& value);
+
+    /** Resolve once the input port with the given key. Reading the returned
+     * handle is equivalent to getInput(), without the cost of the lookup.
+     * Errors (missing port, invalid literal, etc.) are returned by
+     * PortHandle::get().
+     */
+    template <typename T>
+    PortHandle<T> getInputHandle(const std::string& key) const;
+
+    /** Resolve once the output port with the given key. Writing the returned
+     * handle is equivalent to setOutput(), without the cost of the lookup.
+     */
+    template <typename T>
+    PortHandle<T> getOutputHandle(const std::string& key);
+
     /// Check a string and return true if it matches either one of these
     /// two patterns:  {...} or ${...}
     static bool isBlackboardPointer(StringView str);
@@ -153,8 +266,9 @@ class TreeNode
     virtual BT::NodeStatus tick() = 0;
 
     friend class BehaviorTreeFactory;
+    friend class TreeBlueprint;
 
-    // Only BehaviorTreeFactory should call this
+    // Only BehaviorTreeFactory and TreeBlueprint should call this
     void setRegistrationID(StringView ID)
     {
         registration_ID_.assign(ID.data(), ID.size());
@@ -163,13 +277,26 @@ class TreeNode
     void modifyPortsRemapping(const PortsRemapping& new_remapping);
 
   private:
-    const std::string name_;
+    // Reserve "count" consecutive UIDs and return the first one.
+    static uint16_t reserveUIDs(size_t count);
+
+    // The next TreeNode constructed by the calling thread gets this UID,
+    // instead of a new one. Used by TreeBlueprint to make the UIDs
+    // independent of the order of construction.
+    static void setNextUID(uint16_t uid);
+
+    // Forget the UID given to setNextUID(), if not used yet.
+    static void clearNextUID();
 
-    NodeStatus status_;
+    const std::string name_;
 
-    std::condition_variable state_condition_variable_;
+    // Lock-free: status() is read by the parents on every tick, while
+    // AsyncActionNode may write it from a different thread.
+    std::atomic<NodeStatus> status_;
 
-    mutable std::mutex state_mutex_;
+    // Number of threads blocked in waitValidStatus(). setStatus() skips the
+    // wake-up entirely when nobody is waiting.
+    std::atomic<uint32_t> status_waiters_;
 
     StatusChangeSignal state_change_signal_;
 
@@ -182,72 +309,200 @@ class TreeNode
 
 //-------------------------------------------------------
 template <typename T>
-inline Result TreeNode::getInput(const std::string& key, T& destination) const
+inline Result PortHandle<T>::get(T& destination) const
 {
-    auto remap_it = config_.input_ports.find(key);
-    if (remap_it == config_.input_ports.end())
+    if (!error_.empty())
     {
-        return nonstd::make_unexpected(StrCat("getInput() failed because "
-                                              "NodeConfiguration::input_ports "
-                                              "does not contain the key: [",
-                                              key, "]"));
+        return nonstd::make_unexpected(error_);
     }
-    auto remapped_res = getRemappedKey(key, remap_it->second);
+    if (constant_)
+    {
+        destination = *constant_;
+        return {};
+    }
+    if (!entry_)
+    {
+        // the entry might have been created after the resolution of the port
+        entry_ = blackboard_->getEntry(key_);
+    }
+    return readEntry(entry_.get(), destination, port_name_, key_);
+}
+
+template <typename T>
+inline Result PortHandle<T>::readEntry(const Blackboard::Entry* entry, T& destination,
+                                       StringView port_name, StringView key)
+{
     try
     {
-        if (!remapped_res)
+        if (entry)
         {
-            destination = convertFromString<T>(remap_it->second);
-            return {};
+            std::unique_lock<std::mutex> lock(entry->mutex);
+            const Any& val = entry->value;
+            if (val.empty() == false)
+            {
+                if (std::is_same<T, std::string>::value == false && val.type() == typeid(std::string))
+                {
+                    // parse the text without holding the lock
+                    const std::string text = val.cast<std::string>();
+                    lock.unlock();
+                    destination = convertFromString<T>(text);
+                }
+                else
+                {
+                    destination = val.cast<T>();
+                }
+                return {};
+            }
         }
-        const auto& remapped_key = remapped_res.value();
+    }
+    catch (std::exception& err)
+    {
+        return nonstd::make_unexpected(err.what());
+    }
+    return nonstd::make_unexpected(StrCat("getInput() failed because it was unable to find the "
+                                          "key [",
+                                          port_name, "] remapped to [", key, "]"));
+}
 
-        if (!config_.blackboard)
-        {
-            return nonstd::make_unexpected("getInput() trying to access a Blackboard(BB) entry, "
-                                           "but BB is invalid");
-        }
+template <typename T>
+inline Result PortHandle<T>::set(const T& value)
+{
+    return write(value);
+}
+
+template <typename T>
+inline Result PortHandle<T>::set(T&& value)
+{
+    return write(std::move(value));
+}
+
+template <typename T>
+inline Result PortHandle<T>::borrow(LockedConstRef<T>& destination) const
+{
+    if (!error_.empty())
+    {
+        return nonstd::make_unexpected(error_);
+    }
+    if (constant_)
+    {
+        return nonstd::make_unexpected(StrCat("getInput() failed: the port [", port_name_,
+                                              "] contains a literal, it can not be borrowed"));
+    }
+    if (!entry_)
+    {
+        entry_ = blackboard_->getEntry(key_);
+    }
+    if (!entry_)
+    {
+        return nonstd::make_unexpected(StrCat("getInput() failed because it was unable to find the "
+                                              "key [",
+                                              port_name_, "] remapped to [", key_, "]"));
+    }
+    // release the previous reference first: it might lock the same entry
+    destination = LockedConstRef<T>();
+    destination = LockedConstRef<T>(entry_);
+    if (!destination)
+    {
+        return nonstd::make_unexpected(StrCat("getInput() failed: the entry [", key_,
+                                              "] doesn't contain a [", demangle(typeid(T)), "]"));
+    }
+    return {};
+}
+
+template <typename T>
+template <typename U>
+inline Result PortHandle<T>::write(U&& value)
+{
+    if (!error_.empty())
+    {
+        return nonstd::make_unexpected(error_);
+    }
+    if (constant_)
+    {
+        return nonstd::make_unexpected(StrCat("setOutput() failed: the port [", port_name_,
+                                              "] contains a literal, not a Blackboard entry"));
+    }
+    if (!entry_)
+    {
+        // first write: let the Blackboard create the entry (and the
+        // placeholder of a remapped one)
+        blackboard_->set(key_, std::forward<U>(value));
+        entry_ = blackboard_->getEntry(key_);
+        return {};
+    }
+    Blackboard::assignValue(*entry_, std::forward<U>(value));
+    return {};
+}
 
-        const Any* val = config_.blackboard->getAny(nonstd::to_string(remapped_key));
-        if (val && val->empty() == false)
+template <typename T>
+inline PortHandle<T> TreeNode::getInputHandle(const std::string& key) const
+{
+    PortHandle<T> handle;
+    handle.port_name_ = key;
+
+    auto remap_it = config_.input_ports.find(key);
+    if (remap_it == config_.input_ports.end())
+    {
+        handle.error_ = StrCat("getInput() failed because "
+                               "NodeConfiguration::input_ports "
+                               "does not contain the key: [",
+                               key, "]");
+        return handle;
+    }
+    auto remapped_res = getRemappedKey(key, remap_it->second);
+    if (!remapped_res)
+    {
+        try
         {
-            if (std::is_same<T, std::string>::value == false && val->type() == typeid(std::string))
+            auto const_it = config_.input_constants.find(key);
+            if (const_it != config_.input_constants.end() && const_it->second.type() == typeid(T))
             {
-                destination = convertFromString<T>(val->cast<std::string>());
+                handle.constant_ = std::make_shared<const T>(const_it->second.cast<T>());
             }
             else
             {
-                destination = val->cast<T>();
+                handle.constant_ = std::make_shared<const T>(convertFromString<T>(remap_it->second));
             }
-            return {};
         }
-
-        return nonstd::make_unexpected(StrCat("getInput() failed because it was unable to find the "
-                                              "key [",
-                                              key, "] remapped to [", remapped_key, "]"));
+        catch (std::exception& err)
+        {
+            handle.error_ = err.what();
+        }
+        return handle;
     }
-    catch (std::exception& err)
+    if (!config_.blackboard)
     {
-        return nonstd::make_unexpected(err.what());
+        handle.error_ = "getInput() trying to access a Blackboard(BB) entry, "
+                        "but BB is invalid";
+        return handle;
     }
+    handle.key_ = nonstd::to_string(remapped_res.value());
+    handle.blackboard_ = config_.blackboard;
+    handle.entry_ = config_.blackboard->getEntry(handle.key_);
+    return handle;
 }
 
 template <typename T>
-inline Result TreeNode::setOutput(const std::string& key, const T& value)
+inline PortHandle<T> TreeNode::getOutputHandle(const std::string& key)
 {
+    PortHandle<T> handle;
+    handle.port_name_ = key;
+
     if (!config_.blackboard)
     {
-        return nonstd::make_unexpected("setOutput() failed: trying to access a "
-                                       "Blackboard(BB) entry, but BB is invalid");
+        handle.error_ = "setOutput() failed: trying to access a "
+                        "Blackboard(BB) entry, but BB is invalid";
+        return handle;
     }
 
     auto remap_it = config_.output_ports.find(key);
     if (remap_it == config_.output_ports.end())
     {
-        return nonstd::make_unexpected(StrCat("setOutput() failed: NodeConfiguration::output_ports "
-                                              "does not "
-                                              "contain the key: [",
-                                              key, "]"));
+        handle.error_ = StrCat("setOutput() failed: NodeConfiguration::output_ports "
+                               "does not "
+                               "contain the key: [",
+                               key, "]");
+        return handle;
     }
     StringView remapped_key = remap_it->second;
     if (remapped_key == "=")
@@ -258,10 +513,86 @@ inline Result TreeNode::setOutput(const std::string& key, const T& value)
     {
         remapped_key = stripBlackboardPointer(remapped_key);
     }
-    const auto& key_str = nonstd::to_string(remapped_key);
+    handle.key_ = nonstd::to_string(remapped_key);
+    handle.blackboard_ = config_.blackboard;
+    return handle;
+}
 
-    config_.blackboard->set(key_str, value);
+template <typename T>
+inline Result TreeNode::getInput(const std::string& key, T& destination) const
+{
+    // same as getInputHandle<T>(key).get(destination), without building
+    // the handle: the entry is read directly
+    auto remap_it = config_.input_ports.find(key);
+    if (remap_it == config_.input_ports.end())
+    {
+        return nonstd::make_unexpected(StrCat("getInput() failed because "
+                                              "NodeConfiguration::input_ports "
+                                              "does not contain the key: [",
+                                              key, "]"));
+    }
+    StringView remapped_key = remap_it->second;
+    if (remapped_key == "=")
+    {
+        remapped_key = key;
+    }
+    else if (isBlackboardPointer(remapped_key))
+    {
+        remapped_key = stripBlackboardPointer(remapped_key);
+    }
+    else
+    {
+        // a literal: use the value parsed already, if it has the same type
+        auto const_it = config_.input_constants.find(key);
+        try
+        {
+            if (const_it != config_.input_constants.end() && const_it->second.type() == typeid(T))
+            {
+                destination = const_it->second.cast<T>();
+            }
+            else
+            {
+                destination = convertFromString<T>(remap_it->second);
+            }
+            return {};
+        }
+        catch (std::exception& err)
+        {
+            return nonstd::make_unexpected(err.what());
+        }
+    }
+    if (!config_.blackboard)
+    {
+        return nonstd::make_unexpected("getInput() trying to access a Blackboard(BB) entry, "
+                                       "but BB is invalid");
+    }
+    auto entry = config_.blackboard->getEntry(remapped_key);
+    return PortHandle<T>::readEntry(entry.get(), destination, key, remapped_key);
+}
 
+template <typename T>
+inline Result TreeNode::getInput(const std::string& key, LockedConstRef<T>& destination) const
+{
+    return getInputHandle<T>(key).borrow(destination);
+}
+
+template <typename T, typename>
+inline Result TreeNode::setOutput(const std::string& key, T&& value)
+{
+    return getOutputHandle<T>(key).set(std::move(value));
+}
+
+template <typename T>
+inline Result TreeNode::setOutput(const std::string& key, const T& value)
+{
+    // string literals are written as const char*
+    using ValueType = typename std::decay<const T>::type;
+    auto handle = getOutputHandle<ValueType>(key);
+    if (!handle.error_.empty())
+    {
+        return nonstd::make_unexpected(handle.error_);
+    }
+    config_.blackboard->set(handle.key_, value);
     return {};
 }
 
@@ -0,0 +1,112 @@
+#ifndef BT_COROUTINE_STACK_POOL_H
+#define BT_COROUTINE_STACK_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace BT
+{
+/**
+ * @brief CoroutineStackPool recycles the stacks of the coroutines of
+ * CoroActionNode, all of the same size.
+ *
+ * Each stack is mapped directly from the OS, with a guard page below it: an
+ * overflow crashes immediately instead of corrupting the memory. The pages
+ * that are never touched are never backed by physical memory, therefore a
+ * large stack costs only address space.
+ *
+ * The stacks are unmapped only by shrink() or by the destructor.
+ *
+ * Not available on Windows, where CoroActionNode uses fibers, that allocate
+ * their own stack: acquire() throws.
+ */
+class CoroutineStackPool
+{
+  public:
+    static constexpr size_t DEFAULT_STACK_SIZE = 1024 * 1024;
+
+    /// Usable memory: [data, data + size). The stack grows downwards, from
+    /// data + size to the guard page below data.
+    struct Stack
+    {
+        char* data = nullptr;
+        size_t size = 0;
+    };
+
+    struct Report
+    {
+        std::string node_type;
+        size_t stack_size;
+        size_t stacks_count;
+        size_t high_water_mark;
+    };
+
+    /// stack_size is rounded up to a multiple of the page size.
+    explicit CoroutineStackPool(size_t stack_size = DEFAULT_STACK_SIZE);
+
+    /// Unmap all the stacks: the ones acquired must not be used anymore.
+    ~CoroutineStackPool();
+
+    CoroutineStackPool(const CoroutineStackPool&) = delete;
+    CoroutineStackPool& operator=(const CoroutineStackPool&) = delete;
+
+    /// Reuse a released stack or map a new one. Throws RuntimeError if the
+    /// memory can't be mapped, or on Windows.
+    Stack acquire();
+
+    void release(Stack stack);
+
+    size_t stackSize() const
+    {
+        return stack_size_;
+    }
+
+    /// Number of stacks mapped, both acquired and released.
+    size_t stacksCount() const;
+
+    /**
+     * @brief highWaterMark estimates the deepest usage of any stack of this
+     * pool, in bytes, rounded up to the page size: the distance between the
+     * top of the stack and the lowest page that is resident in memory.
+     *
+     * It is a lower bound: a page that was touched and then swapped out is
+     * not resident, and is not counted. Use it as a hint when choosing a
+     * smaller stack size, keeping a margin, and measure it again with the
+     * new size. Returns 0 where it can't be measured (Windows).
+     */
+    size_t highWaterMark() const;
+
+    /// Unmap the released stacks.
+    void shrink();
+
+    /// The pool shared by the CoroActionNodes with the given registration ID
+    /// and stack size. The pools live as long as the process.
+    static std::shared_ptr<CoroutineStackPool> forNodeType(const std::string& node_type,
+                                                           size_t stack_size);
+
+    /// Statistics of the pools returned by forNodeType().
+    static std::vector<Report> reportNodeTypes();
+
+    /// shrink() all the pools returned by forNodeType().
+    static void shrinkNodeTypes();
+
+  private:
+    size_t measureStack(const Stack& stack) const;
+
+    void unmapStack(const Stack& stack);
+
+    size_t page_size_;
+    size_t stack_size_;
+    mutable std::mutex mutex_;
+    // all the stacks mapped, acquired or not
+    std::vector<Stack> stacks_;
+    std::vector<Stack> free_stacks_;
+    // high water mark of the stacks already unmapped
+    size_t unmapped_high_water_;
+};
+
+}   // end namespace
+
+#endif   // BT_COROUTINE_STACK_POOL_H
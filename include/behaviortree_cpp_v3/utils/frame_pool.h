@@ -0,0 +1,112 @@
+#ifndef BT_FRAME_POOL_H
+#define BT_FRAME_POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace BT
+{
+/**
+ * @brief Allocator of the frames of the stackless coroutines of a Tree (see
+ * StacklessCoroActionNode).
+ *
+ * A frame is allocated when an action starts and released when it completes
+ * or is halted: the released blocks are kept in a free list for each size
+ * class, and reused by the next frame of similar size. Blocks larger than
+ * MAX_BLOCK_SIZE are not cached.
+ *
+ * Thread-safe: a node may be halted by a thread different from the one
+ * that ticks the tree.
+ */
+class FramePool
+{
+  public:
+    static constexpr size_t GRANULARITY = 64;
+    static constexpr size_t MAX_BLOCK_SIZE = 4096;
+
+    FramePool(): cached_blocks_(0)
+    {
+        for (auto& list: free_lists_)
+        {
+            list = nullptr;
+        }
+    }
+
+    ~FramePool()
+    {
+        for (auto& list: free_lists_)
+        {
+            while (list)
+            {
+                FreeBlock* next = list->next;
+                ::operator delete(list);
+                list = next;
+            }
+        }
+    }
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    void* allocate(size_t size)
+    {
+        if (size > MAX_BLOCK_SIZE)
+        {
+            return ::operator new(size);
+        }
+        const size_t index = sizeClass(size);
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (FreeBlock* block = free_lists_[index])
+            {
+                free_lists_[index] = block->next;
+                cached_blocks_--;
+                return block;
+            }
+        }
+        return ::operator new((index + 1) * GRANULARITY);
+    }
+
+    /// size must be the same passed to allocate().
+    void deallocate(void* ptr, size_t size)
+    {
+        if (size > MAX_BLOCK_SIZE)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+        const size_t index = sizeClass(size);
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        std::unique_lock<std::mutex> lock(mutex_);
+        block->next = free_lists_[index];
+        free_lists_[index] = block;
+        cached_blocks_++;
+    }
+
+    /// Number of released blocks, ready to be reused.
+    size_t cachedBlocks() const
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cached_blocks_;
+    }
+
+  private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static size_t sizeClass(size_t size)
+    {
+        return size == 0 ? 0 : (size - 1) / GRANULARITY;
+    }
+
+    mutable std::mutex mutex_;
+    FreeBlock* free_lists_[MAX_BLOCK_SIZE / GRANULARITY];
+    size_t cached_blocks_;
+};
+
+}   // end namespace
+
+#endif   // BT_FRAME_POOL_H
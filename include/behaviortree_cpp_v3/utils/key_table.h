@@ -0,0 +1,215 @@
+#ifndef BT_KEY_TABLE_H
+#define BT_KEY_TABLE_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "behaviortree_cpp_v3/utils/string_view.hpp"
+
+namespace BT
+{
+/// Integer identifier of an interned key, see KeyTable.
+typedef uint32_t KeyID;
+
+/**
+ * @brief Hash map from KeyID to V, using open addressing and linear probing.
+ *
+ * KeyIDs are dense, therefore they are used directly as hash.
+ * Elements can be added, but never removed.
+ */
+template <typename V>
+class FlatIdMap
+{
+  public:
+    FlatIdMap() : size_(0)
+    {}
+
+    V* find(KeyID id)
+    {
+        const size_t index = slotIndex(id);
+        return (index < keys_.size() && keys_[index] == id) ? &values_[index] : nullptr;
+    }
+
+    const V* find(KeyID id) const
+    {
+        const size_t index = slotIndex(id);
+        return (index < keys_.size() && keys_[index] == id) ? &values_[index] : nullptr;
+    }
+
+    /// Add the element, if not present already.
+    /// Return the element with the given id and true if it was inserted.
+    std::pair<V*, bool> insert(KeyID id, V value)
+    {
+        if ((size_ + 1) * 2 > keys_.size())
+        {
+            grow();
+        }
+        size_t index = slotIndex(id);
+        if (keys_[index] == id)
+        {
+            return { &values_[index], false };
+        }
+        keys_[index] = id;
+        values_[index] = std::move(value);
+        size_++;
+        return { &values_[index], true };
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    /// Call func(KeyID, const V&) for each element, in no particular order.
+    template <typename Func>
+    void forEach(Func&& func) const
+    {
+        for (size_t i = 0; i < keys_.size(); i++)
+        {
+            if (keys_[i] != EMPTY)
+            {
+                func(keys_[i], values_[i]);
+            }
+        }
+    }
+
+  private:
+    static constexpr KeyID EMPTY = std::numeric_limits<KeyID>::max();
+
+    // index of the slot containing id or, if not found, of the first empty one.
+    // Return keys_.size() if the map was never allocated.
+    size_t slotIndex(KeyID id) const
+    {
+        if (keys_.empty())
+        {
+            return 0;
+        }
+        const size_t mask = keys_.size() - 1;
+        size_t index = id & mask;
+        while (keys_[index] != id && keys_[index] != EMPTY)
+        {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void grow()
+    {
+        std::vector<KeyID> old_keys(keys_.empty() ? 8 : keys_.size() * 2, EMPTY);
+        std::vector<V> old_values(old_keys.size());
+        old_keys.swap(keys_);
+        old_values.swap(values_);
+        for (size_t i = 0; i < old_keys.size(); i++)
+        {
+            if (old_keys[i] != EMPTY)
+            {
+                const size_t index = slotIndex(old_keys[i]);
+                keys_[index] = old_keys[i];
+                values_[index] = std::move(old_values[i]);
+            }
+        }
+    }
+
+    std::vector<KeyID> keys_;
+    std::vector<V> values_;
+    size_t size_;
+};
+
+template <typename V>
+constexpr KeyID FlatIdMap<V>::EMPTY;
+
+/**
+ * @brief KeyTable interns strings into dense integer identifiers:
+ * the first key gets 0, the second 1 and so on.
+ *
+ * It is not thread-safe; the owner must provide synchronization.
+ */
+class KeyTable
+{
+  public:
+    /// Return the identifier of the key, adding it if needed.
+    KeyID intern(nonstd::string_view key)
+    {
+        if ((names_.size() + 1) * 2 > slots_.size())
+        {
+            grow();
+        }
+        size_t index = slotIndex(key);
+        if (slots_[index] == EMPTY)
+        {
+            slots_[index] = static_cast<KeyID>(names_.size());
+            names_.emplace_back(key.data(), key.size());
+        }
+        return slots_[index];
+    }
+
+    /// Return false if the key was never interned.
+    bool find(nonstd::string_view key, KeyID& id) const
+    {
+        if (slots_.empty())
+        {
+            return false;
+        }
+        id = slots_[slotIndex(key)];
+        return id != EMPTY;
+    }
+
+    const std::string& name(KeyID id) const
+    {
+        return names_[id];
+    }
+
+    size_t size() const
+    {
+        return names_.size();
+    }
+
+  private:
+    static constexpr KeyID EMPTY = std::numeric_limits<KeyID>::max();
+
+    static uint64_t hash(nonstd::string_view key)
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        for (char c : key)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    size_t slotIndex(nonstd::string_view key) const
+    {
+        const size_t mask = slots_.size() - 1;
+        size_t index = hash(key) & mask;
+        while (slots_[index] != EMPTY && nonstd::string_view(names_[slots_[index]]) != key)
+        {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void grow()
+    {
+        slots_.assign(slots_.empty() ? 16 : slots_.size() * 2, EMPTY);
+        const size_t mask = slots_.size() - 1;
+        for (KeyID id = 0; id < names_.size(); id++)
+        {
+            size_t index = hash(names_[id]) & mask;
+            while (slots_[index] != EMPTY)
+            {
+                index = (index + 1) & mask;
+            }
+            slots_[index] = id;
+        }
+    }
+
+    std::vector<std::string> names_;
+    std::vector<KeyID> slots_;
+};
+
+}   // end namespace BT
+
+#endif   // BT_KEY_TABLE_H
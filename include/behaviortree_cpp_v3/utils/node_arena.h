@@ -0,0 +1,97 @@
+#ifndef BT_NODE_ARENA_H
+#define BT_NODE_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace BT
+{
+/**
+ * @brief Monotonic allocator used to store the nodes of a Tree in a few
+ * contiguous blocks of memory, in the same order in which they are created
+ * (and ticked).
+ *
+ * Memory is released only when the arena is destroyed; it is up to the owner
+ * to call the destructors of the objects created with create().
+ */
+class NodeArena
+{
+  public:
+    explicit NodeArena(size_t initial_block_size = 64 * 1024,
+                       size_t max_block_size = 1024 * 1024)
+      : next_block_size_(initial_block_size),
+        max_block_size_(max_block_size),
+        current_(nullptr),
+        remaining_(0),
+        bytes_used_(0)
+    {}
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        size_t padding = (alignment - (reinterpret_cast<uintptr_t>(current_) % alignment)) % alignment;
+        if (!current_ || padding + size > remaining_)
+        {
+            addBlock(size + alignment);
+            padding = (alignment - (reinterpret_cast<uintptr_t>(current_) % alignment)) % alignment;
+        }
+        char* ptr = current_ + padding;
+        current_ = ptr + size;
+        remaining_ -= (padding + size);
+        bytes_used_ += size;
+        return ptr;
+    }
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        void* memory = allocate(sizeof(T), alignof(T));
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /// Number of blocks allocated so far.
+    size_t blocksCount() const
+    {
+        return blocks_.size();
+    }
+
+    /// Sum of the sizes of all the allocations (padding excluded).
+    size_t bytesUsed() const
+    {
+        return bytes_used_;
+    }
+
+  private:
+    void addBlock(size_t min_size)
+    {
+        size_t block_size = next_block_size_;
+        while (block_size < min_size)
+        {
+            block_size *= 2;
+        }
+        blocks_.emplace_back(new char[block_size]);
+        current_ = blocks_.back().get();
+        remaining_ = block_size;
+        if (next_block_size_ < max_block_size_)
+        {
+            next_block_size_ *= 2;
+        }
+    }
+
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t next_block_size_;
+    size_t max_block_size_;
+    char* current_;
+    size_t remaining_;
+    size_t bytes_used_;
+};
+
+}   // end namespace BT
+
+#endif   // BT_NODE_ARENA_H
@@ -7,6 +7,7 @@
 #include <chrono>
 #include <string>
 #include <cstring>
+#include <cstdint>
 #include <type_traits>
 #include "any.hpp"
 #include "demangle_util.h"
@@ -19,6 +20,8 @@ namespace BT
 {
 // Rational: since type erased numbers will always use at least 8 bytes
 // it is faster to cast everything to either double, uint64_t or int64_t.
+// Numbers are stored inline, in a tagged union; linb::any is used only for
+// strings and custom types.
 class Any
 {
     template <typename T>
@@ -43,74 +46,140 @@ class Any
         typename std::enable_if<!std::is_arithmetic<T>::value && !std::is_enum<T>::value &&
                                 !std::is_same<T, std::string>::value>::type*;
 
+    // custom types passed by rvalue reference are moved in
+    template <typename T>
+    using EnableMovable =
+        typename std::enable_if<!std::is_reference<T>::value && !std::is_arithmetic<T>::value &&
+                                !std::is_enum<T>::value && !std::is_pointer<T>::value &&
+                                !std::is_same<T, std::string>::value &&
+                                !std::is_same<T, SafeAny::SimpleString>::value &&
+                                !std::is_same<T, Any>::value>::type*;
+
+    template <typename T>
+    using EnableKnownType =
+        typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value ||
+                                std::is_same<T, std::string>::value>::type*;
+
+    // what is actually stored
+    enum class Tag : uint8_t
+    {
+        EMPTY,
+        INT64,    // _number.i
+        UINT64,   // _number.u
+        DOUBLE,   // _number.d
+        STRING,   // SafeAny::SimpleString in _any
+        OTHER     // custom type in _any
+    };
+
   public:
-    Any(): _original_type(nullptr)
+    Any(): _original_type(nullptr), _tag(Tag::EMPTY)
     {
+        _number.i = 0;
     }
 
     ~Any() = default;
 
-    Any(const Any& other) : _any(other._any), _original_type( other._original_type )
+    Any(const Any& other) :
+      _number(other._number), _any(other._any),
+      _original_type( other._original_type ), _tag( other._tag )
     {
     }
 
-    Any(Any&& other) : _any( std::move(other._any) ), _original_type( other._original_type )
+    // the moved-from Any is left empty
+    Any(Any&& other) :
+      _number(other._number), _any( std::move(other._any) ),
+      _original_type( other._original_type ), _tag( other._tag )
     {
+        other._original_type = nullptr;
+        other._tag = Tag::EMPTY;
     }
 
-    explicit Any(const double& value) : _any(value), _original_type( &typeid(double) )
+    explicit Any(const double& value) : _original_type( &typeid(double) ), _tag(Tag::DOUBLE)
     {
+        _number.d = value;
     }
 
-    explicit Any(const uint64_t& value) : _any(value), _original_type( &typeid(uint64_t) )
+    explicit Any(const uint64_t& value) : _original_type( &typeid(uint64_t) ), _tag(Tag::UINT64)
     {
+        _number.u = value;
     }
 
-    explicit Any(const float& value) : _any(double(value)), _original_type( &typeid(float) )
+    explicit Any(const float& value) : _original_type( &typeid(float) ), _tag(Tag::DOUBLE)
     {
+        _number.d = double(value);
     }
 
-    explicit Any(const std::string& str) : _any(SafeAny::SimpleString(str)), _original_type( &typeid(std::string) )
+    explicit Any(const std::string& str) :
+      _any(SafeAny::SimpleString(str)), _original_type( &typeid(std::string) ), _tag(Tag::STRING)
     {
+        _number.i = 0;
     }
 
-    explicit Any(const char* str) : _any(SafeAny::SimpleString(str)), _original_type( &typeid(std::string) )
+    explicit Any(const char* str) :
+      _any(SafeAny::SimpleString(str)), _original_type( &typeid(std::string) ), _tag(Tag::STRING)
     {
+        _number.i = 0;
     }
 
-    explicit Any(const SafeAny::SimpleString& str) : _any(str), _original_type( &typeid(std::string) )
+    explicit Any(const SafeAny::SimpleString& str) :
+      _any(str), _original_type( &typeid(std::string) ), _tag(Tag::STRING)
     {
+        _number.i = 0;
     }
 
     // all the other integrals are casted to int64_t
     template <typename T>
-    explicit Any(const T& value, EnableIntegral<T> = 0) : _any(int64_t(value)), _original_type( &typeid(T) )
+    explicit Any(const T& value, EnableIntegral<T> = 0) : _original_type( &typeid(T) ), _tag(Tag::INT64)
     {
+        _number.i = int64_t(value);
     }
 
     // default for other custom types
     template <typename T>
-    explicit Any(const T& value, EnableNonIntegral<T> = 0) : _any(value), _original_type( &typeid(T) )
+    explicit Any(const T& value, EnableNonIntegral<T> = 0) :
+      _any(value), _original_type( &typeid(T) ), _tag(Tag::OTHER)
     {
+        _number.i = 0;
+    }
+
+    template <typename T>
+    explicit Any(T&& value, EnableMovable<T> = 0) :
+      _any(std::move(value)), _original_type( &typeid(T) ), _tag(Tag::OTHER)
+    {
+        _number.i = 0;
     }
 
     Any& operator = (const Any& other)
     {
+        this->_number = other._number;
         this->_any = other._any;
         this->_original_type = other._original_type;
+        this->_tag = other._tag;
+        return *this;
+    }
+
+    Any& operator = (Any&& other)
+    {
+        if( this != &other )
+        {
+            this->_number = other._number;
+            this->_any = std::move(other._any);
+            this->_original_type = other._original_type;
+            this->_tag = other._tag;
+            other._original_type = nullptr;
+            other._tag = Tag::EMPTY;
+        }
         return *this;
     }
 
     bool isNumber() const
     {
-        return _any.type() == typeid(int64_t) ||
-               _any.type() == typeid(uint64_t) ||
-               _any.type() == typeid(double);
+        return _tag == Tag::INT64 || _tag == Tag::UINT64 || _tag == Tag::DOUBLE;
     }
 
     bool isString() const
     {
-        return _any.type() == typeid(SafeAny::SimpleString);
+        return _tag == Tag::STRING;
     }
 
     // this is different from any_cast, because if allows safe
@@ -118,23 +187,19 @@ class Any
     template <typename T>
     T cast() const
     {
-        if( _any.empty() )
+        if( _tag == Tag::EMPTY )
         {
             throw std::runtime_error("Any::cast failed because it is empty");
         }
-        if (_any.type() == typeid(T))
-        {
-            return linb::any_cast<T>(_any);
-        }
-        else
-        {
-            auto res = convert<T>();
-            if( !res )
-            {
-                throw std::runtime_error( res.error() );
-            }
-            return res.value();
-        }
+        return castImpl<T>();
+    }
+
+    /// Pointer to the stored value, without any copy or conversion.
+    /// Available only for custom types; nullptr if the type is not T.
+    template <typename T>
+    const T* castPtr() const noexcept
+    {
+        return (_tag == Tag::OTHER) ? linb::any_cast<T>(&_any) : nullptr;
     }
 
     const std::type_info& type() const noexcept
@@ -144,67 +209,105 @@ class Any
 
     const std::type_info& castedType() const noexcept
     {
-        return _any.type();
+        switch( _tag )
+        {
+            case Tag::INT64:  return typeid(int64_t);
+            case Tag::UINT64: return typeid(uint64_t);
+            case Tag::DOUBLE: return typeid(double);
+            default:          return _any.type();
+        }
     }
 
     bool empty() const noexcept
     {
-        return _any.empty();
+        return _tag == Tag::EMPTY;
     }
 
   private:
+    union Number
+    {
+        int64_t i;
+        uint64_t u;
+        double d;
+    };
+
+    Number _number;
     linb::any _any;
     const std::type_info* _original_type;
+    Tag _tag;
 
     //----------------------------
 
-    template <typename DST>
-    nonstd::expected<DST,std::string> convert(EnableString<DST> = 0) const
+    // custom types can not be converted
+    template <typename T>
+    T castImpl(EnableUnknownType<T> = 0) const
     {
-        const auto& type = _any.type();
-
-        if (type == typeid(SafeAny::SimpleString))
-        {
-            return linb::any_cast<SafeAny::SimpleString>(_any).toStdString();
-        }
-        else if (type == typeid(int64_t))
+        if( _any.type() == typeid(T) )
         {
-            return std::to_string(linb::any_cast<int64_t>(_any));
+            return linb::any_cast<T>(_any);
         }
-        else if (type == typeid(uint64_t))
+        throw std::runtime_error( errorMsg<T>() );
+    }
+
+    template <typename T>
+    T castImpl(EnableKnownType<T> = 0) const
+    {
+        auto res = convert<T>();
+        if( !res )
         {
-            return std::to_string(linb::any_cast<uint64_t>(_any));
+            throw std::runtime_error( res.error() );
         }
-        else if (type == typeid(double))
+        return std::move( res.value() );
+    }
+
+    template <typename DST>
+    nonstd::expected<DST,std::string> convert(EnableString<DST> = 0) const
+    {
+        switch( _tag )
         {
-            return std::to_string(linb::any_cast<double>(_any));
+            case Tag::STRING:
+                return linb::any_cast<const SafeAny::SimpleString&>(_any).toStdString();
+            case Tag::INT64:
+                return std::to_string(_number.i);
+            case Tag::UINT64:
+                return std::to_string(_number.u);
+            case Tag::DOUBLE:
+                return std::to_string(_number.d);
+            default:
+                return nonstd::make_unexpected( errorMsg<DST>() );
         }
-
-        return nonstd::make_unexpected( errorMsg<DST>() );
     }
 
     template <typename DST>
     nonstd::expected<DST,std::string> convert(EnableArithmetic<DST> = 0) const
     {
         using SafeAny::details::convertNumber;
-        DST out;
 
-        const auto& type = _any.type();
-
-        if (type == typeid(int64_t))
+        if( _original_type == &typeid(DST) && isNumber() )
         {
-            convertNumber<int64_t, DST>(linb::any_cast<int64_t>(_any), out);
-        }
-        else if (type == typeid(uint64_t))
-        {
-            convertNumber<uint64_t, DST>(linb::any_cast<uint64_t>(_any), out);
+            // the value was created from a DST: no need to check the range
+            switch( _tag )
+            {
+                case Tag::INT64:  return static_cast<DST>(_number.i);
+                case Tag::UINT64: return static_cast<DST>(_number.u);
+                default:          return static_cast<DST>(_number.d);
+            }
         }
-        else if (type == typeid(double))
+
+        DST out;
+        switch( _tag )
         {
-            convertNumber<double, DST>(linb::any_cast<double>(_any), out);
-        }
-        else{
-            return nonstd::make_unexpected( errorMsg<DST>() );
+            case Tag::INT64:
+                convertNumber<int64_t, DST>(_number.i, out);
+                break;
+            case Tag::UINT64:
+                convertNumber<uint64_t, DST>(_number.u, out);
+                break;
+            case Tag::DOUBLE:
+                convertNumber<double, DST>(_number.d, out);
+                break;
+            default:
+                return nonstd::make_unexpected( errorMsg<DST>() );
         }
         return out;
     }
@@ -212,35 +315,22 @@ class Any
     template <typename DST>
     nonstd::expected<DST,std::string> convert(EnableEnum<DST> = 0) const
     {
-        using SafeAny::details::convertNumber;
-
-        const auto& type = _any.type();
-
-        if (type == typeid(int64_t))
-        {
-            uint64_t out = linb::any_cast<int64_t>(_any);
-            return static_cast<DST>(out);
-        }
-        else if (type == typeid(uint64_t))
+        switch( _tag )
         {
-            uint64_t out = linb::any_cast<uint64_t>(_any);
-            return static_cast<DST>(out);
+            case Tag::INT64:
+                return static_cast<DST>(_number.i);
+            case Tag::UINT64:
+                return static_cast<DST>(_number.u);
+            default:
+                return nonstd::make_unexpected( errorMsg<DST>() );
         }
-
-        return nonstd::make_unexpected( errorMsg<DST>() );
-    }
-
-    template <typename DST>
-    nonstd::expected<DST,std::string> convert(EnableUnknownType<DST> = 0) const
-    {
-        return nonstd::make_unexpected( errorMsg<DST>() );
     }
 
     template <typename T>
     std::string errorMsg() const
     {
         return StrCat("[Any::convert]: no known safe conversion between [",
-                      demangle( _any.type() ), "] and [", demangle( typeid(T) ),"]");
+                      demangle( castedType() ), "] and [", demangle( typeid(T) ),"]");
     }
 };
 
@@ -57,7 +57,7 @@ class SharedLibrary
         ///
         /// This flag is ignored on platforms that do not use dlopen().
 
-        SHLIB_LOCAL = 2
+        SHLIB_LOCAL = 2,
         /// On platforms that use dlopen(), use RTLD_LOCAL instead of RTLD_GLOBAL.
         ///
         /// Note that if this flag is specified, RTTI (including dynamic_cast and throw) will
@@ -65,6 +65,14 @@ class SharedLibrary
         /// compilers as well. See http://gcc.gnu.org/faq.html#dso for more information.
         ///
         /// This flag is ignored on platforms that do not use dlopen().
+
+        SHLIB_LAZY = 4
+        /// On platforms that use dlopen(), use RTLD_LAZY instead of RTLD_NOW:
+        /// the functions are resolved when they are called for the first time.
+        /// The library loads faster, but a missing symbol is detected only
+        /// when it is used.
+        ///
+        /// This flag is ignored on platforms that do not use dlopen().
     };
 
     SharedLibrary();
@@ -1,15 +1,20 @@
 #ifndef SIMPLE_SIGNAL_H
 #define SIMPLE_SIGNAL_H
 
+#include <atomic>
 #include <memory>
 #include <functional>
 #include <vector>
+#include <algorithm>
 
 namespace BT
 {
 /**
  * Super simple Signal/Slop implementation, AKA "Observable pattern".
  * The subscriber is active until it goes out of scope or Subscriber::reset() is called.
+ *
+ * The number of active subscribers is tracked, so that the publisher can use
+ * hasSubscribers() to skip the preparation of the arguments altogether.
  */
 template <typename... CallableArgs>
 class Signal
@@ -18,8 +23,21 @@ class Signal
     using CallableFunction = std::function<void(CallableArgs...)>;
     using Subscriber = std::shared_ptr<CallableFunction>;
 
+    Signal(): active_count_(std::make_shared<std::atomic<size_t>>(0))
+    {}
+
+    /// True if at least one Subscriber is still alive. Cheap, lock-free.
+    bool hasSubscribers() const
+    {
+        return active_count_->load(std::memory_order_relaxed) != 0;
+    }
+
     void notify(CallableArgs... args)
     {
+        if (!hasSubscribers())
+        {
+            return;
+        }
         for (size_t i = 0; i < subscribers_.size();)
         {
             if (auto sub = subscribers_[i].lock())
@@ -36,13 +54,27 @@ class Signal
 
     Subscriber subscribe(CallableFunction func)
     {
-        Subscriber sub = std::make_shared<CallableFunction>(std::move(func));
+        // remove the subscribers that expired since the last notify()
+        subscribers_.erase(std::remove_if(subscribers_.begin(), subscribers_.end(),
+                                          [](const std::weak_ptr<CallableFunction>& weak) {
+                                              return weak.expired();
+                                          }),
+                           subscribers_.end());
+
+        // the counter is captured by value, because the Subscriber may outlive the Signal
+        std::shared_ptr<std::atomic<size_t>> counter = active_count_;
+        counter->fetch_add(1);
+        Subscriber sub(new CallableFunction(std::move(func)), [counter](CallableFunction* ptr) {
+            counter->fetch_sub(1);
+            delete ptr;
+        });
         subscribers_.emplace_back(sub);
         return sub;
     }
 
   private:
     std::vector<std::weak_ptr<CallableFunction>> subscribers_;
+    std::shared_ptr<std::atomic<size_t>> active_count_;
 };
 }
 
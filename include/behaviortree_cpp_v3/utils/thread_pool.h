@@ -0,0 +1,63 @@
+#ifndef BT_THREAD_POOL_H
+#define BT_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BT
+{
+/**
+ * @brief ThreadPool executes tasks on a bounded number of threads, in the
+ * same order in which they are posted.
+ *
+ * The threads are started only when they are needed, i.e. when a task is
+ * posted and all the threads are busy, up to maxThreads(). The destructor
+ * executes the tasks still in the queue, then joins the threads.
+ *
+ * The tasks must not throw.
+ *
+ * See BehaviorTreeFactory::setAsyncExecutor().
+ */
+class ThreadPool
+{
+  public:
+    /// If max_threads is 0, std::thread::hardware_concurrency() is used.
+    explicit ThreadPool(size_t max_threads = 0);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void post(std::function<void()> task);
+
+    size_t maxThreads() const
+    {
+        return max_threads_;
+    }
+
+    /// Number of threads started so far.
+    size_t threadsCount() const;
+
+    /// Number of tasks waiting for a free thread.
+    size_t pendingTasks() const;
+
+  private:
+    void workerLoop();
+
+    mutable std::mutex mutex_;
+    std::condition_variable task_signal_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    size_t max_threads_;
+    size_t idle_threads_;
+    bool stop_;
+};
+
+}   // end namespace
+
+#endif   // BT_THREAD_POOL_H
@@ -0,0 +1,103 @@
+#ifndef BT_TIMER_SERVICE_H
+#define BT_TIMER_SERVICE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace BT
+{
+/**
+ * @brief TimerService executes handlers at a given time in the future, in a
+ * single thread shared by all its timers. The thread is started by the first
+ * call to add().
+ *
+ * The armed timers are stored in a binary heap, indexed by ID: both add() and
+ * cancel() are O(log n), and a cancelled timer is removed immediately.
+ *
+ * The handlers are executed one at the time: a slow handler delays all the
+ * timers that expire meanwhile. Keep them short, and move the real work to
+ * another thread.
+ *
+ * Unlike TimerQueue, the handler of a cancelled timer is never executed.
+ * Pending timers are discarded when the service is destroyed.
+ *
+ * TimeoutNode uses TimerService::global().
+ */
+class TimerService
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    TimerService();
+
+    ~TimerService();
+
+    TimerService(const TimerService&) = delete;
+    TimerService& operator=(const TimerService&) = delete;
+
+    /// The service shared by the whole process.
+    static const std::shared_ptr<TimerService>& global();
+
+    /// Execute handler after the given delay. Returns the ID of the timer,
+    /// never 0.
+    uint64_t add(std::chrono::milliseconds delay, std::function<void()> handler);
+
+    /**
+     * @brief cancel the timer with the given ID.
+     *
+     * When it returns, the handler is not running and it will not be executed,
+     * unless cancel() is called by the handler itself.
+     *
+     * @return true if the timer was armed, false if it expired already or the
+     * ID is not valid.
+     */
+    bool cancel(uint64_t id);
+
+    /// Number of armed timers.
+    size_t size() const;
+
+  private:
+    struct HeapEntry
+    {
+        Clock::time_point deadline;
+        uint32_t slot;
+    };
+
+    struct Slot
+    {
+        std::function<void()> handler;
+        // incremented when the slot is released: the IDs of the previous
+        // timers in this slot become invalid
+        uint32_t generation = 1;
+        uint32_t heap_index = 0;
+    };
+
+    void run();
+
+    // must be called with mutex_ locked
+    void siftUp(size_t index);
+    void siftDown(size_t index);
+    void removeFromHeap(size_t index);
+    std::function<void()> releaseSlot(uint32_t slot);
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_signal_;
+    std::condition_variable done_signal_;
+    std::vector<HeapEntry> heap_;
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_slots_;
+    // ID of the timer whose handler is being executed, or 0
+    uint64_t running_id_;
+    std::thread thread_;
+    bool stop_;
+};
+
+}   // end namespace
+
+#endif   // BT_TIMER_SERVICE_H
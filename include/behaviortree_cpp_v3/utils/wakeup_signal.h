@@ -0,0 +1,90 @@
+#ifndef BT_WAKEUP_SIGNAL_H
+#define BT_WAKEUP_SIGNAL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace BT
+{
+/**
+ * @brief WakeUpSignal wakes up the thread that ticks a Tree, blocked in
+ * Tree::sleep(), when something that may change the result of the next tick
+ * happened.
+ *
+ * Signals are not counted: many emitSignal() before waitFor() wake it up once.
+ */
+class WakeUpSignal
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    WakeUpSignal(): ready_(false), has_deadline_(false)
+    {}
+
+    /// Wake up the waiting thread now.
+    void emitSignal()
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_ = true;
+        }
+        cv_.notify_all();
+    }
+
+    /// Wake up the waiting thread at the given time, if not earlier.
+    /// Only the earliest deadline is stored.
+    void requestWakeUpAt(Clock::time_point deadline)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if( has_deadline_ && deadline_ <= deadline )
+            {
+                return;
+            }
+            has_deadline_ = true;
+            deadline_ = deadline;
+        }
+        cv_.notify_all();
+    }
+
+    /**
+     * @brief waitFor blocks until emitSignal() is called, a requested
+     * deadline expires or the timeout expires.
+     *
+     * @return false if the timeout expired, true otherwise.
+     */
+    bool waitFor(Clock::duration timeout)
+    {
+        const auto timeout_point = Clock::now() + timeout;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while( !ready_ )
+        {
+            const bool use_deadline = has_deadline_ && deadline_ <= timeout_point;
+            const auto wake_up_point = use_deadline ? deadline_ : timeout_point;
+            if( Clock::now() >= wake_up_point )
+            {
+                if( use_deadline )
+                {
+                    has_deadline_ = false;
+                    return true;
+                }
+                return false;
+            }
+            cv_.wait_until(lock, wake_up_point);
+        }
+        ready_ = false;
+        return true;
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool ready_;
+    bool has_deadline_;
+    Clock::time_point deadline_;
+};
+
+}   // end namespace
+
+#endif   // BT_WAKEUP_SIGNAL_H
@@ -11,6 +11,44 @@ namespace BT
  * of a BehaviorTree from file or text and instantiate the
  * corresponding tree using the BehaviorTreeFactory.
  */
+/**
+ * @brief XMLDocumentCache keeps the files parsed by XMLParser, to parse them
+ * only once; see BehaviorTreeFactory::setXMLDocumentCache().
+ *
+ * A file is identified by its absolute path, and it is parsed again if its
+ * modification time or its size changed. The strings of a document are
+ * normalized before it is cached, so that reading it doesn't modify it: the
+ * same cache can be used by multiple parsers and factories, also from
+ * different threads.
+ */
+class XMLDocumentCache
+{
+  public:
+    XMLDocumentCache();
+
+    ~XMLDocumentCache();
+
+    XMLDocumentCache(const XMLDocumentCache& other) = delete;
+    XMLDocumentCache& operator=(const XMLDocumentCache& other) = delete;
+
+    /// A cache shared by the whole process.
+    static const std::shared_ptr<XMLDocumentCache>& global();
+
+    /// Number of documents in the cache.
+    size_t size() const;
+
+    /// Number of files parsed by the cache, i.e. the cache misses.
+    size_t parsedCount() const;
+
+    void clear();
+
+  private:
+    friend class XMLParser;
+
+    struct Pimpl;
+    Pimpl* _p;
+};
+
 class XMLParser: public Parser
 {
   public:
@@ -27,6 +65,9 @@ class XMLParser: public Parser
 
     Tree instantiateTree(const Blackboard::Ptr &root_blackboard) override;
 
+    /// Compile the loaded XML, to instantiate the same Tree many times.
+    TreeBlueprint createBlueprint();
+
   private:
 
     struct Pimpl;
@@ -39,6 +80,25 @@ void VerifyXML(const std::string& xml_text,
 
 std::string writeTreeNodesModelXML(const BehaviorTreeFactory& factory);
 
+/// The nodes registered by a plugin, without the plugin itself.
+struct PluginManifest
+{
+    std::string plugin_path;
+    std::vector<TreeNodeManifest> nodes;
+};
+
+/**
+ * @brief writePluginManifestXML writes the manifests of all the nodes of
+ * the factory, except the builtin ones, as a manifest of the plugin at
+ * plugin_path. See BehaviorTreeFactory::registerFromPluginManifest().
+ */
+std::string writePluginManifestXML(const BehaviorTreeFactory& factory,
+                                   const std::string& plugin_path);
+
+/// Read a manifest written by writePluginManifestXML().
+/// Only the names of the types of the ports are written: the ports read are untyped.
+PluginManifest readPluginManifestXML(const std::string& xml_text);
+
 }
 
 #endif   // XML_PARSING_BT_H
@@ -51,14 +51,17 @@ NodeStatus SimpleActionNode::tick()
 //-------------------------------------------------------
 
 AsyncActionNode::AsyncActionNode(const std::string& name, const NodeConfiguration& config)
-  : ActionNodeBase(name, config)
+  : ActionNodeBase(name, config),
+    keep_thread_alive_(false),
+    start_action_(false),
+    task_running_(false)
 {
 
 }
 
 AsyncActionNode::~AsyncActionNode()
 {
-    if (thread_.joinable())
+    if (thread_.joinable() || taskRunning())
     {
         stopAndJoinThread();
     }
@@ -99,30 +102,115 @@ void AsyncActionNode::asyncThreadLoop()
             {
                 std::cerr << "\nUncaught exception from the method tick() of an AsyncActionNode: ["
                           << registrationName() << "/" << name() << "]\n" << std::endl;
+                std::unique_lock<std::mutex> lock(start_mutex_);
                 exptr_ = std::current_exception();
                 keep_thread_alive_ = false;
             }
+            emitWakeUpSignal();
         }
     }
 }
 
+void AsyncActionNode::startInExecutor(ThreadPool& executor)
+{
+    std::unique_lock<std::mutex> lock(start_mutex_);
+    // under the lock: executorTask() can't overwrite it with a stale result
+    setStatus(NodeStatus::RUNNING);
+    if (exptr_)
+    {
+        return;
+    }
+    keep_thread_alive_ = true;
+    if (task_running_)
+    {
+        // halted and started again before the previous tick() returned:
+        // as with the dedicated thread, the two calls are serialized.
+        start_action_ = true;
+        return;
+    }
+    task_running_ = true;
+    start_action_ = false;
+    lock.unlock();
+    executor.post([this]() { executorTask(); });
+}
+
+void AsyncActionNode::executorTask()
+{
+    while (true)
+    {
+        // the node could be halted while the task was in the queue
+        if (keep_thread_alive_ && status() == NodeStatus::RUNNING)
+        {
+            try {
+                const NodeStatus result = tick();
+                // if halted and started again meanwhile, the result is stale:
+                // the status stays RUNNING and tick() is called again below
+                std::unique_lock<std::mutex> lock(start_mutex_);
+                if (!start_action_)
+                {
+                    setStatus(result);
+                }
+            }
+            catch (std::exception&)
+            {
+                std::cerr << "\nUncaught exception from the method tick() of an AsyncActionNode: ["
+                          << registrationName() << "/" << name() << "]\n" << std::endl;
+                std::unique_lock<std::mutex> lock(start_mutex_);
+                exptr_ = std::current_exception();
+                keep_thread_alive_ = false;
+            }
+            emitWakeUpSignal();
+        }
+
+        std::unique_lock<std::mutex> lock(start_mutex_);
+        if (start_action_ && keep_thread_alive_)
+        {
+            start_action_ = false;
+            continue;
+        }
+        start_action_ = false;
+        task_running_ = false;
+        // the node may be destroyed as soon as the lock is released
+        start_signal_.notify_all();
+        return;
+    }
+}
+
+bool AsyncActionNode::taskRunning()
+{
+    std::unique_lock<std::mutex> lock(start_mutex_);
+    return task_running_;
+}
+
 NodeStatus AsyncActionNode::executeTick()
 {
     //send signal to other thread.
     // The other thread is in charge for changing the status
     if (status() == NodeStatus::IDLE)
     {
-        if( thread_.joinable() == false) {
-            keep_thread_alive_ = true;
-            thread_ = std::thread(&AsyncActionNode::asyncThreadLoop, this);
+        if (const auto& executor = config().async_executor)
+        {
+            startInExecutor(*executor);
+        }
+        else
+        {
+            setStatus( NodeStatus::RUNNING );
+            if( thread_.joinable() == false) {
+                keep_thread_alive_ = true;
+                thread_ = std::thread(&AsyncActionNode::asyncThreadLoop, this);
+            }
+            notifyStart();
         }
-        setStatus( NodeStatus::RUNNING );
-        notifyStart();
     }
 
-    if( exptr_ )
+    std::exception_ptr exptr;
+    {
+        std::unique_lock<std::mutex> lock(start_mutex_);
+        exptr = exptr_;
+    }
+    if( exptr )
     {
-        std::rethrow_exception(exptr_);
+        std::rethrow_exception(exptr);
     }
     return status();
 }
@@ -134,7 +222,8 @@ void AsyncActionNode::stopAndJoinThread()
     {
         halt();
     }
-    else{
+    else if (thread_.joinable())
+    {
         // loop in asyncThreadLoop() is blocked at waitStart(). Unblock it.
         notifyStart();
     }
@@ -143,6 +232,13 @@ void AsyncActionNode::stopAndJoinThread()
     {
         thread_.join();
     }
+
+    // wait for the task posted to the executor, if any
+    std::unique_lock<std::mutex> lock(start_mutex_);
+    while (task_running_)
+    {
+        start_signal_.wait(lock);
+    }
 }
 
 
@@ -164,29 +260,52 @@ NodeStatus SyncActionNode::executeTick()
 //-------------------------------------
 #ifndef BT_NO_COROUTINES
 #include "coroutine/coroutine.h"
+#include "behaviortree_cpp_v3/utils/coroutine_stack_pool.h"
 
 struct CoroActionNode::Pimpl
 {
     coroutine::routine_t coro;
     std::atomic<bool> pending_destroy;
+    size_t stack_size;
+    // shared by the nodes with the same registration ID and stack size
+    std::shared_ptr<CoroutineStackPool> stack_pool;
+    CoroutineStackPool::Stack stack;
 
+    void destroyCoroutine()
+    {
+        coroutine::destroy(coro);
+        coro = 0;
+        if (stack_pool)
+        {
+            stack_pool->release(stack);
+        }
+        stack = CoroutineStackPool::Stack();
+    }
 };
 
 
 CoroActionNode::CoroActionNode(const std::string &name,
                                const NodeConfiguration& config):
+  CoroActionNode(name, config, CoroutineStackPool::DEFAULT_STACK_SIZE)
+{
+}
+
+CoroActionNode::CoroActionNode(const std::string &name,
+                               const NodeConfiguration& config,
+                               size_t stack_size):
   ActionNodeBase (name, config),
   _p(new  Pimpl)
 {
     _p->coro = 0;
     _p->pending_destroy = false;
+    _p->stack_size = stack_size;
 }
 
 CoroActionNode::~CoroActionNode()
 {
     if( _p->coro != 0 )
     {
-        coroutine::destroy(_p->coro);
+        _p->destroyCoroutine();
     }
 }
 
@@ -200,17 +319,28 @@ NodeStatus CoroActionNode::executeTick()
 {
     if( _p->pending_destroy && _p->coro != 0 )
     {
-        coroutine::destroy(_p->coro);
-        _p->coro = 0;
+        _p->destroyCoroutine();
         _p->pending_destroy = false;
     }
 
     if ( _p->coro == 0)
     {
-        _p->coro = coroutine::create( [this]()
+        auto func = [this]()
         {
             setStatus(tick());
-        } );
+        };
+#ifdef _MSC_VER
+        // fibers allocate their own stack
+        _p->coro = coroutine::create( func, nullptr, _p->stack_size );
+#else
+        if( !_p->stack_pool )
+        {
+            // the registration ID is known only after the construction
+            _p->stack_pool = CoroutineStackPool::forNodeType( registrationName(), _p->stack_size );
+        }
+        _p->stack = _p->stack_pool->acquire();
+        _p->coro = coroutine::create( func, _p->stack.data, _p->stack.size );
+#endif
     }
 
     if( _p->coro != 0 )
@@ -218,8 +348,7 @@ NodeStatus CoroActionNode::executeTick()
         if( _p->pending_destroy ||
             coroutine::resume(_p->coro) == coroutine::ResumeResult::FINISHED )
         {
-            coroutine::destroy(_p->coro);
-            _p->coro = 0;
+            _p->destroyCoroutine();
             _p->pending_destroy = false;
         }
     }
@@ -234,6 +363,84 @@ void CoroActionNode::halt()
 
 
 
+#ifdef BT_CPP20_COROUTINES
+
+namespace
+{
+// Stores the FramePool of the frame, keeping the alignment of operator new.
+constexpr std::size_t FRAME_HEADER_SIZE = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+static_assert(FRAME_HEADER_SIZE >= sizeof(FramePool*), "header too small");
+}
+
+StacklessCoroActionNode::StacklessCoroActionNode(const std::string& name,
+                                                 const NodeConfiguration& config):
+  ActionNodeBase(name, config)
+{
+}
+
+void* StacklessCoroActionNode::allocateFrame(std::size_t size, FramePool* pool)
+{
+    const std::size_t total = size + FRAME_HEADER_SIZE;
+    char* memory = static_cast<char*>( pool ? pool->allocate(total) : ::operator new(total) );
+    *reinterpret_cast<FramePool**>(memory) = pool;
+    return memory + FRAME_HEADER_SIZE;
+}
+
+void StacklessCoroActionNode::deallocateFrame(void* ptr, std::size_t size)
+{
+    char* memory = static_cast<char*>(ptr) - FRAME_HEADER_SIZE;
+    FramePool* pool = *reinterpret_cast<FramePool**>(memory);
+    if( pool )
+    {
+        pool->deallocate( memory, size + FRAME_HEADER_SIZE );
+    }
+    else{
+        ::operator delete( memory );
+    }
+}
+
+NodeStatus StacklessCoroActionNode::tick()
+{
+    if( !task_.handle_ )
+    {
+        task_ = coroTick();
+    }
+    auto& promise = task_.handle_.promise();
+    if( promise.ready )
+    {
+        if( !promise.ready(promise.ready_arg) )
+        {
+            return NodeStatus::RUNNING;
+        }
+        promise.ready = nullptr;
+    }
+
+    task_.handle_.resume();
+    if( !task_.handle_.done() )
+    {
+        return NodeStatus::RUNNING;
+    }
+
+    const NodeStatus result = promise.result;
+    const std::exception_ptr exception = promise.exception;
+    task_.reset();
+    if( exception )
+    {
+        std::rethrow_exception( exception );
+    }
+    if( result != NodeStatus::SUCCESS && result != NodeStatus::FAILURE )
+    {
+        throw LogicError("StacklessCoroActionNode::coroTick() must co_return SUCCESS or FAILURE");
+    }
+    return result;
+}
+
+void StacklessCoroActionNode::halt()
+{
+    task_.reset();
+}
+#endif
+
 NodeStatus StatefulActionNode::tick()
 {
   const NodeStatus initial_status = status();
@@ -1,6 +1,12 @@
 #include "behaviortree_cpp_v3/basic_types.h"
+#include <algorithm>
+#include <clocale>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
 
 namespace BT
 {
@@ -93,6 +99,241 @@ template<> std::string toStr<NodeType>(NodeType type)
 }
 
 
+namespace
+{
+bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+StringView trimSpaces(StringView str)
+{
+    size_t first = 0;
+    size_t last = str.size();
+    while( first < last && isSpace(str[first]) )
+    {
+        first++;
+    }
+    while( last > first && isSpace(str[last-1]) )
+    {
+        last--;
+    }
+    return str.substr(first, last - first);
+}
+
+RuntimeError invalidNumber(StringView str, const char* type_name)
+{
+    return RuntimeError("convertFromString(): [", str, "] is not a valid ", type_name);
+}
+
+// Parse the whole str, with bounds and overflow checks.
+template <typename T>
+T parseInteger(StringView str)
+{
+    static_assert( std::is_integral<T>::value && sizeof(T) <= sizeof(int32_t),
+                   "the value is accumulated in a uint64_t" );
+    const StringView text = trimSpaces(str);
+    const char* pos = text.data();
+    const char* const end = pos + text.size();
+
+    bool negative = false;
+    if( pos < end && (*pos == '-' || *pos == '+') )
+    {
+        negative = (*pos == '-');
+        pos++;
+    }
+    if( pos == end )
+    {
+        throw invalidNumber(str, "integer");
+    }
+    const uint64_t max_value = negative ?
+                uint64_t(-(int64_t(std::numeric_limits<T>::min()) + 1)) + 1 :
+                uint64_t(std::numeric_limits<T>::max());
+    uint64_t value = 0;
+    for(; pos < end; pos++ )
+    {
+        const unsigned digit = unsigned(*pos) - '0';
+        if( digit > 9 )
+        {
+            throw invalidNumber(str, "integer");
+        }
+        // value <= 2^32 here: value * 10 doesn't overflow
+        value = value * 10 + digit;
+        if( value > max_value )
+        {
+            throw RuntimeError("convertFromString(): [", str, "] is out of range");
+        }
+    }
+    if( negative )
+    {
+        // two's complement, without overflow when value == -min()
+        return value == 0 ? T(0) : T( -int64_t(value - 1) - 1 );
+    }
+    return T(value);
+}
+
+// Fallback of parseReal(): strtod, in the "C" locale. The text is copied,
+// because strtod needs a terminated string.
+double parseRealSlow(StringView text, StringView str)
+{
+    char buffer[128];
+    std::string long_text;
+    const char* c_str = buffer;
+    if( text.size() < sizeof(buffer) )
+    {
+        std::memcpy(buffer, text.data(), text.size());
+        buffer[text.size()] = '\0';
+    }
+    else{
+        long_text.assign(text.data(), text.size());
+        c_str = long_text.c_str();
+    }
+
+    char* parsed_end = nullptr;
+#if defined(_WIN32)
+    static const _locale_t c_locale = _create_locale(LC_NUMERIC, "C");
+    const double value = _strtod_l(c_str, &parsed_end, c_locale);
+#else
+    static const locale_t c_locale = newlocale(LC_NUMERIC_MASK, "C", locale_t(0));
+    const double value = strtod_l(c_str, &parsed_end, c_locale);
+#endif
+    if( text.empty() || parsed_end != c_str + text.size() )
+    {
+        throw invalidNumber(str, "real number");
+    }
+    return value;
+}
+
+// Most real numbers written by humans have few digits and a small exponent:
+// in that case, both the mantissa and the power of 10 are exact doubles and
+// the result of a single multiplication or division is correctly rounded
+// (Clinger's fast path). The other cases are given to strtod.
+double parseReal(StringView str)
+{
+    static const double powers_of_10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const uint64_t max_exact_mantissa = uint64_t(1) << 53;
+    const int max_digits = 19; // fits in uint64_t
+
+    const StringView text = trimSpaces(str);
+    const char* pos = text.data();
+    const char* const end = pos + text.size();
+
+    bool negative = false;
+    if( pos < end && (*pos == '-' || *pos == '+') )
+    {
+        negative = (*pos == '-');
+        pos++;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;          // significant digits in mantissa
+    int exponent = 0;
+    bool any_digit = false;
+    bool too_many_digits = false;
+
+    auto addDigit = [&](unsigned digit)
+    {
+        any_digit = true;
+        if( digits == 0 && digit == 0 )
+        {
+            return; // leading zero
+        }
+        if( digits < max_digits )
+        {
+            mantissa = mantissa * 10 + digit;
+            digits++;
+        }
+        else{
+            too_many_digits = true;
+        }
+    };
+
+    for(; pos < end && unsigned(*pos - '0') <= 9; pos++ )
+    {
+        addDigit( unsigned(*pos - '0') );
+        if( too_many_digits )
+        {
+            return parseRealSlow(text, str);
+        }
+    }
+    if( pos < end && *pos == '.' )
+    {
+        for( pos++; pos < end && unsigned(*pos - '0') <= 9; pos++ )
+        {
+            addDigit( unsigned(*pos - '0') );
+            if( too_many_digits )
+            {
+                return parseRealSlow(text, str);
+            }
+            exponent--;
+        }
+    }
+    if( !any_digit )
+    {
+        // inf, nan, or not a number at all
+        return parseRealSlow(text, str);
+    }
+    if( pos < end && (*pos == 'e' || *pos == 'E') )
+    {
+        pos++;
+        bool negative_exp = false;
+        if( pos < end && (*pos == '-' || *pos == '+') )
+        {
+            negative_exp = (*pos == '-');
+            pos++;
+        }
+        if( pos == end )
+        {
+            throw invalidNumber(str, "real number");
+        }
+        int explicit_exp = 0;
+        for(; pos < end && unsigned(*pos - '0') <= 9; pos++ )
+        {
+            if( explicit_exp > 10000 )
+            {
+                return parseRealSlow(text, str);
+            }
+            explicit_exp = explicit_exp * 10 + int(*pos - '0');
+        }
+        exponent += negative_exp ? -explicit_exp : explicit_exp;
+    }
+    if( pos != end )
+    {
+        // hexadecimal numbers and invalid text
+        return parseRealSlow(text, str);
+    }
+
+    double value;
+    if( mantissa == 0 )
+    {
+        value = 0.0;
+    }
+    else if( mantissa <= max_exact_mantissa && exponent >= -22 && exponent <= 22 )
+    {
+        value = double(mantissa);
+        value = exponent < 0 ? value / powers_of_10[-exponent] :
+                               value * powers_of_10[exponent];
+    }
+    else{
+        return parseRealSlow(text, str);
+    }
+    return negative ? -value : value;
+}
+
+// Number of parts returned by splitString()
+size_t countParts(StringView str, char delimiter)
+{
+    if( str.empty() )
+    {
+        return 0;
+    }
+    const size_t count = size_t(std::count(str.begin(), str.end(), delimiter));
+    return str.back() == delimiter ? count : count + 1;
+}
+}
+
 template <>
 std::string convertFromString<std::string>(StringView str)
 {
@@ -109,53 +350,42 @@ const char* convertFromString<const char*>(StringView str)
 template <>
 int convertFromString<int>(StringView str)
 {
-    return  std::stoi(str.data());
+    return parseInteger<int>(str);
 }
 
 template <>
 unsigned convertFromString<unsigned>(StringView str)
 {
-    return unsigned(std::stoul(str.data()));
+    return parseInteger<unsigned>(str);
 }
 
 template <>
 double convertFromString<double>(StringView str)
 {
-    // see issue #120
-    // http://quick-bench.com/DWaXRWnxtxvwIMvZy2DxVPEKJnE
-
-    const auto old_locale = std::setlocale(LC_NUMERIC,nullptr);
-    std::setlocale(LC_NUMERIC,"C");
-    double val = std::stod(str.data());
-    std::setlocale(LC_NUMERIC,old_locale);
-    return val;
+    return parseReal(str);
 }
 
 template <>
 std::vector<int> convertFromString<std::vector<int>>(StringView str)
 {
-    auto parts = splitString(str, ';');
     std::vector<int> output;
-    output.reserve( parts.size() );
-    for(const StringView& part: parts)
+    output.reserve( countParts(str, ';') );
+    forEachSplit(str, ';', [&output](StringView part)
     {
-        char* end;
-        output.push_back( std::strtol( part.data(), &end, 10 ) );
-    }
+        output.push_back( parseInteger<int>(part) );
+    });
     return output;
 }
 
 template <>
 std::vector<double> convertFromString<std::vector<double>>(StringView str)
 {
-    auto parts = splitString(str, ';');
     std::vector<double> output;
-    output.reserve( parts.size() );
-    for(const StringView& part: parts)
+    output.reserve( countParts(str, ';') );
+    forEachSplit(str, ';', [&output](StringView part)
     {
-        char* end;
-        output.push_back( std::strtod( part.data(), &end ) );
-    }
+        output.push_back( parseReal(part) );
+    });
     return output;
 }
 
@@ -241,20 +471,11 @@ std::ostream& operator<<(std::ostream& os, const PortDirection& type)
 std::vector<StringView> splitString(const StringView &strToSplit, char delimeter)
 {
     std::vector<StringView> splitted_strings;
-    splitted_strings.reserve(4);
-
-    size_t pos = 0;
-    while( pos < strToSplit.size())
+    splitted_strings.reserve( countParts(strToSplit, delimeter) );
+    forEachSplit(strToSplit, delimeter, [&splitted_strings](StringView part)
     {
-        size_t new_pos = strToSplit.find_first_of(delimeter, pos);
-        if( new_pos == std::string::npos)
-        {
-           new_pos = strToSplit.size();
-        }
-        StringView sv = { &strToSplit.data()[pos], new_pos - pos };
-        splitted_strings.push_back( sv );
-        pos = new_pos + 1;
-    }
+        splitted_strings.push_back( part );
+    });
     return splitted_strings;
 }
 
@@ -34,7 +34,11 @@ void applyRecursiveVisitor(const TreeNode* node,
     }
     else if (auto decorator = dynamic_cast<const BT::DecoratorNode*>(node))
     {
-        applyRecursiveVisitor(decorator->child(), visitor);
+        // a lazy SubTree has no child until it is ticked
+        if (decorator->child() || decorator->type() != NodeType::SUBTREE)
+        {
+            applyRecursiveVisitor(decorator->child(), visitor);
+        }
     }
 }
 
@@ -56,7 +60,11 @@ void applyRecursiveVisitor(TreeNode* node, const std::function<void(TreeNode*)>&
     }
     else if (auto decorator = dynamic_cast<BT::DecoratorNode*>(node))
     {
-        applyRecursiveVisitor(decorator->child(), visitor);
+        // a lazy SubTree has no child until it is ticked
+        if (decorator->child() || decorator->type() != NodeType::SUBTREE)
+        {
+            applyRecursiveVisitor(decorator->child(), visitor);
+        }
     }
 }
 
@@ -86,7 +94,10 @@ void printTreeRecursively(const TreeNode* root_node)
         }
         else if (auto decorator = dynamic_cast<const BT::DecoratorNode*>(node))
         {
-            recursivePrint(indent, decorator->child());
+            if (decorator->child() || decorator->type() != NodeType::SUBTREE)
+            {
+                recursivePrint(indent, decorator->child());
+            }
         }
     };
 
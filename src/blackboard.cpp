@@ -1,75 +1,267 @@
 #include "behaviortree_cpp_v3/blackboard.h"
+#include <algorithm>
 
 namespace BT{
 
+constexpr KeyID KeyTable::EMPTY;
+
 void Blackboard::setPortInfo(std::string key, const PortInfo& info)
 {
+    KeyID id = shared_->intern(key);
+    Blackboard* bb = this;
+    Blackboard::Ptr parent; // keeps bb alive
+
+    // declare the port in this Blackboard and in the ones it is remapped to
+    while( true )
+    {
+        Blackboard::Ptr next;
+        {
+            std::unique_lock<std::mutex> lock(bb->mutex_);
+            auto entry = bb->storage_.find(id);
+            if( !entry )
+            {
+                bb->storage_.insert( id, std::make_shared<Entry>(info) );
+            }
+            else{
+                auto old_type = (*entry)->port_info.type();
+                if( old_type && old_type != info.type() )
+                {
+                    throw LogicError( "Blackboard::set() failed: once declared, the type of a port shall not change. "
+                                     "Declared type [",     BT::demangle( old_type ),
+                                     "] != current type [", BT::demangle( info.type() ), "]" );
+                }
+            }
+
+            const Remapping* remapping = bb->internal_to_external_.find(id);
+            next = remapping ? bb->parent_bb_.lock() : nullptr;
+            if( !next )
+            {
+                break;
+            }
+            id = remapping->external_id;
+        }
+        parent = std::move(next);
+        bb = parent.get();
+    }
+}
+
+const PortInfo* Blackboard::portInfo(const std::string &key)
+{
+    KeyID id;
+    if( !shared_->find(key, id) )
+    {
+        return nullptr;
+    }
     std::unique_lock<std::mutex> lock(mutex_);
+    auto entry = storage_.find(id);
+    if( !entry )
+    {
+        return nullptr;
+    }
+    return &((*entry)->port_info);
+}
 
-    if( auto parent = parent_bb_.lock())
+std::shared_ptr<Blackboard::Entry> Blackboard::getEntry(StringView key) const
+{
+    KeyID id;
+    if( !shared_->find(key, id) )
     {
-        auto remapping_it = internal_to_external_.find(key);
-        if( remapping_it != internal_to_external_.end())
+        return nullptr;
+    }
+    Blackboard::Ptr owner;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const Remapping* remapping = internal_to_external_.find(id);
+        owner = remapping ? remapping->owner.lock() : nullptr;
+        if( !owner )
         {
-            parent->setPortInfo( remapping_it->second, info );
+            auto entry = storage_.find(id);
+            return entry ? *entry : nullptr;
         }
+        id = remapping->owner_id;
     }
+    std::unique_lock<std::mutex> lock(owner->mutex_);
+    auto entry = owner->storage_.find(id);
+    return entry ? *entry : nullptr;
+}
 
-    auto it = storage_.find(key);
-    if( it == storage_.end() )
+std::shared_ptr<Blackboard::Entry> Blackboard::getOrCreateEntry(StringView key)
+{
+    const KeyID id = shared_->intern(key);
+    Blackboard::Ptr owner;
+    KeyID owner_id;
+    bool has_placeholder;
     {
-        storage_.insert( { std::move(key), Entry(info) } );
+        std::unique_lock<std::mutex> lock(mutex_);
+        const Remapping* remapping = internal_to_external_.find(id);
+        owner = remapping ? remapping->owner.lock() : nullptr;
+        if( !owner )
+        {
+            auto entry = storage_.find(id);
+            if( entry )
+            {
+                return *entry;
+            }
+            // create for the first time without any info
+            return *(storage_.insert( id, std::make_shared<Entry>( PortInfo() ) ).first);
+        }
+        owner_id = remapping->owner_id;
+        has_placeholder = storage_.find(id) != nullptr;
     }
-    else{
-        auto old_type = it->second.port_info.type();
-        if( old_type && old_type != info.type() )
+
+    // the placeholder of the remapped key is created only once,
+    // together with the entry in the owner
+    if( has_placeholder )
+    {
+        std::unique_lock<std::mutex> lock(owner->mutex_);
+        if( auto entry = owner->storage_.find(owner_id) )
         {
-            throw LogicError( "Blackboard::set() failed: once declared, the type of a port shall not change. "
-                             "Declared type [",     BT::demangle( old_type ),
-                             "] != current type [", BT::demangle( info.type() ), "]" );
+            return *entry;
         }
     }
+    return createEntryChain(id, *owner, owner_id);
 }
 
-const PortInfo* Blackboard::portInfo(const std::string &key)
+std::shared_ptr<Blackboard::Entry> Blackboard::createEntryChain(KeyID id, const Blackboard& owner,
+                                                                KeyID owner_id)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    auto it = storage_.find(key);
-    if( it == storage_.end() )
+    // the placeholders get the type of the final entry, if already declared
+    std::shared_ptr<Entry> owner_entry;
     {
-        return nullptr;
+        std::unique_lock<std::mutex> lock(owner.mutex_);
+        if( auto entry = owner.storage_.find(owner_id) )
+        {
+            owner_entry = *entry;
+        }
+    }
+
+    Blackboard* bb = this;
+    Blackboard::Ptr parent; // keeps bb alive
+
+    // The entries are inserted only if missing: concurrent calls build
+    // the same chain.
+    while( true )
+    {
+        Blackboard::Ptr next;
+        KeyID next_id;
+        bool virgin_entry;
+        {
+            std::unique_lock<std::mutex> lock(bb->mutex_);
+            const Remapping* remapping = bb->internal_to_external_.find(id);
+            next = remapping ? bb->parent_bb_.lock() : nullptr;
+            if( !next )
+            {
+                return *(bb->storage_.insert( id, std::make_shared<Entry>( PortInfo() ) ).first);
+            }
+            next_id = remapping->external_id;
+            virgin_entry = !bb->storage_.find(id);
+        }
+
+        if( virgin_entry )
+        {
+            PortInfo info;
+            if( owner_entry )
+            {
+                info = owner_entry->port_info;
+            }
+            else{
+                std::unique_lock<std::mutex> lock(next->mutex_);
+                if( auto parent_entry = next->storage_.find(next_id) )
+                {
+                    info = (*parent_entry)->port_info;
+                }
+            }
+            std::unique_lock<std::mutex> lock(bb->mutex_);
+            bb->storage_.insert( id, std::make_shared<Entry>( info ) );
+        }
+        id = next_id;
+        parent = std::move(next);
+        bb = parent.get();
     }
-    return &(it->second.port_info);
+}
+
+void Blackboard::watchEntry(const std::string& key, const std::shared_ptr<WakeUpSignal>& signal)
+{
+    auto entry = getOrCreateEntry(key);
+    std::unique_lock<std::mutex> lock(entry->mutex);
+    // forget the watchers already destroyed
+    auto& watchers = entry->watchers;
+    watchers.erase( std::remove_if( watchers.begin(), watchers.end(),
+                                    [](const std::weak_ptr<WakeUpSignal>& w) { return w.expired(); }),
+                    watchers.end() );
+    for (const auto& watcher: watchers)
+    {
+        if( watcher.lock() == signal )
+        {
+            return;
+        }
+    }
+    watchers.push_back( signal );
 }
 
 void Blackboard::addSubtreeRemapping(std::string internal, std::string external)
 {
-    internal_to_external_.insert( {std::move(internal), std::move(external)} );
+    const KeyID internal_id = shared_->intern(internal);
+    Remapping remapping;
+    remapping.external_id = shared_->intern(external);
+    remapping.owner_id = remapping.external_id;
+
+    if( auto parent = parent_bb_.lock() )
+    {
+        std::unique_lock<std::mutex> lock(parent->mutex_);
+        parent->remapped_by_children_.insert( remapping.external_id, 1 );
+        remapping.owner = parent;
+
+        // flatten the chain: the parent is remapped already
+        const Remapping* parent_remapping =
+            parent->internal_to_external_.find(remapping.external_id);
+        if( parent_remapping && !parent_remapping->owner.expired() )
+        {
+            remapping.owner = parent_remapping->owner;
+            remapping.owner_id = parent_remapping->owner_id;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    // the entry of internal in this Blackboard may be referenced already by
+    // a flattened chain, that would not be redirected
+    if( storage_.find(internal_id) || remapped_by_children_.find(internal_id) )
+    {
+        throw LogicError( "Blackboard::addSubtreeRemapping() failed: the key [", internal,
+                          "] is used already. The remappings must be added top-down, "
+                          "before the entries are created" );
+    }
+    internal_to_external_.insert( internal_id, std::move(remapping) );
 }
 
 void Blackboard::debugMessage() const
 {
-    for(const auto& entry_it: storage_)
+    std::unique_lock<std::mutex> lock(mutex_);
+    const bool has_parent = !parent_bb_.expired();
+
+    storage_.forEach( [&](KeyID id, const std::shared_ptr<Entry>& entry_ptr)
     {
-        auto port_type = entry_it.second.port_info.type();
+        const Entry& entry = *entry_ptr;
+        std::unique_lock<std::mutex> entry_lock(entry.mutex);
+
+        auto port_type = entry.port_info.type();
         if( !port_type )
         {
-            port_type = &( entry_it.second.value.type() );
+            port_type = &( entry.value.type() );
         }
 
-        std::cout <<  entry_it.first << " (" << demangle( port_type ) << ") -> ";
+        std::cout <<  shared_->name(id) << " (" << demangle( port_type ) << ") -> ";
 
-        if( auto parent = parent_bb_.lock())
+        if( has_parent )
         {
-            auto remapping_it = internal_to_external_.find( entry_it.first );
-            if( remapping_it != internal_to_external_.end())
+            if( const Remapping* remapping = internal_to_external_.find( id ) )
             {
-                std::cout << "remapped to parent [" << remapping_it->second << "]" <<std::endl;
-                continue;
+                std::cout << "remapped to parent [" << shared_->name(remapping->external_id) << "]" <<std::endl;
+                return;
             }
         }
-        std::cout << ((entry_it.second.value.empty()) ? "empty" : "full") <<  std::endl;
-    }
+        std::cout << ((entry.value.empty()) ? "empty" : "full") <<  std::endl;
+    });
 }
 
 }
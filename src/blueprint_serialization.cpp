@@ -0,0 +1,296 @@
+#include "behaviortree_cpp_v3/bt_factory.h"
+#include "behaviortree_cpp_v3/flatbuffers/BT_blueprint_generated.h"
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BT
+{
+namespace
+{
+typedef flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Serialization::PortConfig>>>
+PortConfigsOffset;
+
+template <typename Container>
+PortConfigsOffset createPortConfigs(flatbuffers::FlatBufferBuilder& builder,
+                                    const Container& pairs)
+{
+    std::vector<flatbuffers::Offset<Serialization::PortConfig>> ports;
+    ports.reserve(pairs.size());
+    for (const auto& it: pairs)
+    {
+        ports.push_back( Serialization::CreatePortConfigDirect(
+                             builder, it.first.c_str(), it.second.c_str()) );
+    }
+    return builder.CreateVector(ports);
+}
+
+const char* safeStr(const flatbuffers::String* str)
+{
+    return str ? str->c_str() : "";
+}
+
+void readPortConfigs(const flatbuffers::Vector<flatbuffers::Offset<Serialization::PortConfig>>* ports,
+                     PortsRemapping& output)
+{
+    if (!ports)
+    {
+        return;
+    }
+    for (const Serialization::PortConfig* port: *ports)
+    {
+        output.insert( { safeStr(port->port_name()), safeStr(port->remap()) } );
+    }
+}
+}
+
+std::vector<uint8_t> TreeBlueprint::serialize() const
+{
+    flatbuffers::FlatBufferBuilder builder(1024);
+
+    std::vector<flatbuffers::Offset<flatbuffers::String>> registration_names;
+    for (const Builder& node_builder: def_->builders)
+    {
+        registration_names.push_back( builder.CreateString(node_builder.ID) );
+    }
+
+    std::vector<flatbuffers::Offset<Serialization::BlueprintNode>> nodes;
+    nodes.reserve( def_->nodes.size() );
+    for (const NodeRecord& record: def_->nodes)
+    {
+        std::vector<std::pair<std::string, std::string>> declared_ports;
+        for (const PortDeclaration& port: record.port_declarations)
+        {
+            declared_ports.emplace_back( port.port_name, port.key );
+        }
+        nodes.push_back( Serialization::CreateBlueprintNode(
+                             builder,
+                             builder.CreateString(record.instance_name),
+                             record.builder_index,
+                             record.parent_index,
+                             static_cast<uint32_t>(record.blackboard_index),
+                             record.subtree,
+                             createPortConfigs(builder, record.input_ports),
+                             createPortConfigs(builder, record.output_ports),
+                             createPortConfigs(builder, declared_ports) ) );
+    }
+
+    std::vector<flatbuffers::Offset<Serialization::BlueprintBlackboard>> blackboards;
+    for (const BlackboardRecord& record: def_->blackboards)
+    {
+        blackboards.push_back( Serialization::CreateBlueprintBlackboard(
+                                   builder,
+                                   static_cast<uint32_t>(record.parent_index),
+                                   createPortConfigs(builder, record.remappings) ) );
+    }
+
+    auto root = Serialization::CreateBlueprint( builder,
+                                                builder.CreateVector(registration_names),
+                                                builder.CreateVector(nodes),
+                                                builder.CreateVector(blackboards) );
+    Serialization::FinishBlueprintBuffer(builder, root);
+
+    return std::vector<uint8_t>( builder.GetBufferPointer(),
+                                 builder.GetBufferPointer() + builder.GetSize() );
+}
+
+TreeBlueprint BehaviorTreeFactory::createBlueprintFromBinary(const uint8_t* data, size_t size) const
+{
+    flatbuffers::Verifier verifier(data, size);
+    if( !Serialization::VerifyBlueprintBuffer(verifier) )
+    {
+        throw RuntimeError("createBlueprintFromBinary: the data is not a valid TreeBlueprint");
+    }
+    const Serialization::Blueprint* fb_blueprint = Serialization::GetBlueprint(data);
+
+    TreeBlueprint blueprint;
+    blueprint.use_node_arena_ = use_node_arena_;
+    blueprint.instantiation_threads_ = instantiation_threads_;
+    blueprint.lazy_subtrees_ = lazy_subtrees_;
+    blueprint.subtree_idle_time_ = subtree_idle_time_;
+    blueprint.def_->async_executor = async_executor_;
+
+    if( const auto names = fb_blueprint->registration_names() )
+    {
+        for (const flatbuffers::String* name: *names)
+        {
+            const std::string ID = name->str();
+            const TreeNodeRegistration* reg = registration(ID);
+            if( !reg )
+            {
+                throw RuntimeError("createBlueprintFromBinary: ID [", ID, "] not registered");
+            }
+            TreeBlueprint::Builder node_builder;
+            node_builder.ID = ID;
+            node_builder.builder = reg->builder;
+            node_builder.arena_builder = reg->arena_builder;
+            blueprint.def_->builders.push_back( std::move(node_builder) );
+        }
+    }
+
+    // The Tree is instantiated without any further check: validate the indexes here
+    auto Corrupted = [](const char* what)
+    {
+        return RuntimeError("createBlueprintFromBinary: corrupted data, ", what);
+    };
+
+    size_t blackboards_count = 1;
+    if( const auto fb_nodes = fb_blueprint->nodes() )
+    {
+        blueprint.def_->nodes.reserve( fb_nodes->size() );
+        for (const Serialization::BlueprintNode* fb_node: *fb_nodes)
+        {
+            TreeBlueprint::NodeRecord record;
+            record.instance_name = fb_node->instance_name()->str();
+            record.builder_index = fb_node->builder_index();
+            record.parent_index = fb_node->parent_index();
+            record.blackboard_index = fb_node->blackboard_index();
+            record.subtree = fb_node->subtree();
+
+            if( record.builder_index < -1 ||
+                record.builder_index >= static_cast<int>(blueprint.def_->builders.size()) )
+            {
+                throw Corrupted("wrong builder_index");
+            }
+            if( record.parent_index < -1 ||
+                record.parent_index >= static_cast<int>(blueprint.def_->nodes.size()) ||
+                (record.parent_index == -1 && !blueprint.def_->nodes.empty()) )
+            {
+                throw Corrupted("wrong parent_index");
+            }
+            if( record.blackboard_index >= blackboards_count )
+            {
+                throw Corrupted("wrong blackboard_index");
+            }
+            if( record.builder_index == -1 && !record.subtree )
+            {
+                throw Corrupted("a node without builder must be a SubTree");
+            }
+            if( record.subtree )
+            {
+                blackboards_count++;
+            }
+
+            readPortConfigs( fb_node->input_ports(), record.input_ports );
+            readPortConfigs( fb_node->output_ports(), record.output_ports );
+
+            const TreeNodeRegistration* reg = nullptr;
+            if( record.builder_index >= 0 )
+            {
+                const auto& ID = blueprint.def_->builders[record.builder_index].ID;
+                reg = &registrations_.at(ID);
+                TreeBlueprint::parseInputConstants(record, *reg);
+            }
+
+            const auto declared_ports = fb_node->declared_ports();
+            if( declared_ports && declared_ports->size() > 0 )
+            {
+                if( !reg )
+                {
+                    throw Corrupted("a SubTree can't declare ports");
+                }
+                const auto& ID = reg->manifest.registration_ID;
+                for (const Serialization::PortConfig* port: *declared_ports)
+                {
+                    const char* port_name = safeStr(port->port_name());
+                    const TreeNodeRegistration::Port* port_entry = reg->findPort(port_name);
+                    if( !port_entry )
+                    {
+                        throw RuntimeError("createBlueprintFromBinary: the manifest of [", ID,
+                                           "] does not contain the port [", port_name, "]");
+                    }
+                    record.port_declarations.push_back(
+                        { port_entry->name, safeStr(port->remap()), port_entry->info } );
+                }
+            }
+            blueprint.def_->nodes.push_back( std::move(record) );
+        }
+    }
+
+    const auto fb_blackboards = fb_blueprint->blackboards();
+    if( !fb_blackboards || fb_blackboards->size() != blackboards_count )
+    {
+        throw Corrupted("wrong number of blackboards");
+    }
+    for (const Serialization::BlueprintBlackboard* fb_blackboard: *fb_blackboards)
+    {
+        TreeBlueprint::BlackboardRecord record;
+        record.parent_index = fb_blackboard->parent_index();
+        if( !blueprint.def_->blackboards.empty() && record.parent_index >= blueprint.def_->blackboards.size() )
+        {
+            throw Corrupted("wrong parent_index of a blackboard");
+        }
+        if( const auto remappings = fb_blackboard->remappings() )
+        {
+            for (const Serialization::PortConfig* remapping: *remappings)
+            {
+                record.remappings.emplace_back( safeStr(remapping->port_name()),
+                                                safeStr(remapping->remap()) );
+            }
+        }
+        blueprint.def_->blackboards.push_back( std::move(record) );
+    }
+
+    blueprint.def_->manifests = manifests_;
+    blueprint.def_->computeSubtreeRanges();
+    return blueprint;
+}
+
+TreeBlueprint BehaviorTreeFactory::createBlueprintFromBinaryFile(const std::string& file_path) const
+{
+#ifdef _WIN32
+    std::ifstream file(file_path, std::ios::binary);
+    if( !file )
+    {
+        throw RuntimeError("createBlueprintFromBinaryFile: can't open the file [", file_path, "]");
+    }
+    std::vector<uint8_t> data( (std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>() );
+    return createBlueprintFromBinary( data.data(), data.size() );
+#else
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if( fd < 0 )
+    {
+        throw RuntimeError("createBlueprintFromBinaryFile: can't open the file [", file_path, "]");
+    }
+    struct stat file_stat;
+    if( ::fstat(fd, &file_stat) != 0 || file_stat.st_size == 0 )
+    {
+        ::close(fd);
+        throw RuntimeError("createBlueprintFromBinaryFile: the file [", file_path, "] is empty");
+    }
+    const size_t size = static_cast<size_t>(file_stat.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if( data == MAP_FAILED )
+    {
+        throw RuntimeError("createBlueprintFromBinaryFile: can't map the file [", file_path, "]");
+    }
+
+    try {
+        auto blueprint = createBlueprintFromBinary( static_cast<const uint8_t*>(data), size );
+        ::munmap(data, size);
+        return blueprint;
+    }
+    catch(...)
+    {
+        ::munmap(data, size);
+        throw;
+    }
+#endif
+}
+
+Tree BehaviorTreeFactory::createTreeFromBinaryFile(const std::string& file_path,
+                                                   Blackboard::Ptr blackboard)
+{
+    return createBlueprintFromBinaryFile(file_path).instantiate(blackboard);
+}
+
+}   // end namespace
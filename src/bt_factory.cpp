@@ -13,10 +13,20 @@
 #include "behaviortree_cpp_v3/bt_factory.h"
 #include "behaviortree_cpp_v3/utils/shared_library.h"
 #include "behaviortree_cpp_v3/xml_parsing.h"
+#include "filesystem/path.h"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 namespace BT
 {
-BehaviorTreeFactory::BehaviorTreeFactory()
+BehaviorTreeFactory::BehaviorTreeFactory():
+    use_node_arena_(false),
+    verify_xml_(true),
+    instantiation_threads_(1),
+    lazy_subtrees_(false),
+    subtree_idle_time_(0)
 {
     registerNodeType<FallbackNode>("Fallback");
     registerNodeType<SequenceNode>("Sequence");
@@ -61,7 +71,9 @@ bool BehaviorTreeFactory::unregisterBuilder(const std::string& ID)
         return false;
     }
     builders_.erase(ID);
+    arena_builders_.erase(ID);
     manifests_.erase(ID);
+    registrations_.erase(ID);
     return true;
 }
 
@@ -75,6 +87,29 @@ void BehaviorTreeFactory::registerBuilder(const TreeNodeManifest& manifest, cons
 
     builders_.insert(  {manifest.registration_ID, builder} );
     manifests_.insert( {manifest.registration_ID, manifest} );
+
+    TreeNodeRegistration& registration = registrations_[manifest.registration_ID];
+    registration.manifest = manifest;
+    registration.builder = builder;
+    for (const auto& port: manifest.ports)
+    {
+        registration.ports.push_back( {port.first, port.second} );
+    }
+    std::sort( registration.ports.begin(), registration.ports.end(),
+               [](const TreeNodeRegistration::Port& a, const TreeNodeRegistration::Port& b)
+               { return a.name < b.name; } );
+}
+
+const TreeNodeRegistration::Port* TreeNodeRegistration::findPort(const char* name) const
+{
+    auto it = std::lower_bound( ports.begin(), ports.end(), name,
+                                [](const Port& port, const char* key)
+                                { return strcmp( port.name.c_str(), key ) < 0; } );
+    if( it != ports.end() && it->name == name )
+    {
+        return &(*it);
+    }
+    return nullptr;
 }
 
 void BehaviorTreeFactory::registerSimpleCondition(const std::string& ID,
@@ -131,6 +166,82 @@ void BehaviorTreeFactory::registerFromPlugin(const std::string& file_path)
     }
 }
 
+namespace
+{
+// A plugin registered from its manifest. It is loaded by the first call of
+// builder(), into its own factory.
+class LazyPlugin
+{
+  public:
+    explicit LazyPlugin(std::string path): path_( std::move(path) )
+    {}
+
+    const NodeBuilder& builder(const std::string& ID)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if( !factory_ )
+        {
+            BT::SharedLibrary loader;
+            loader.load(path_, SharedLibrary::SHLIB_LAZY);
+            if( !loader.hasSymbol(PLUGIN_SYMBOL) )
+            {
+                throw RuntimeError("ERROR loading library [", path_, "]: can't find symbol [",
+                                   PLUGIN_SYMBOL, "]");
+            }
+            typedef void (*Func)(BehaviorTreeFactory&);
+            Func func = (Func)loader.getSymbol(PLUGIN_SYMBOL);
+
+            std::unique_ptr<BehaviorTreeFactory> factory( new BehaviorTreeFactory );
+            func(*factory);
+            factory_ = std::move(factory);
+        }
+        // factory_ doesn't change anymore: the builder stays valid
+        auto it = factory_->builders().find(ID);
+        if( it == factory_->builders().end() )
+        {
+            throw RuntimeError("The plugin [", path_, "] doesn't register the node [", ID,
+                               "] of its manifest");
+        }
+        return it->second;
+    }
+
+  private:
+    const std::string path_;
+    std::mutex mutex_;
+    std::unique_ptr<BehaviorTreeFactory> factory_;
+};
+}
+
+void BehaviorTreeFactory::registerFromPluginManifest(const std::string& manifest_path)
+{
+    std::ifstream file(manifest_path);
+    if( !file )
+    {
+        throw RuntimeError("registerFromPluginManifest: can't open the file [", manifest_path, "]");
+    }
+    std::stringstream text;
+    text << file.rdbuf();
+    const PluginManifest manifest = readPluginManifestXML( text.str() );
+
+    filesystem::path plugin_path( manifest.plugin_path );
+    const filesystem::path manifest_dir = filesystem::path( manifest_path ).parent_path();
+    if( !plugin_path.is_absolute() && !manifest_dir.empty() )
+    {
+        plugin_path = manifest_dir / plugin_path;
+    }
+
+    auto plugin = std::make_shared<LazyPlugin>( plugin_path.str() );
+    for (const TreeNodeManifest& node_manifest: manifest.nodes)
+    {
+        const std::string ID = node_manifest.registration_ID;
+        registerBuilder( node_manifest, [plugin, ID](const std::string& name,
+                                                     const NodeConfiguration& config)
+        {
+            return plugin->builder(ID)(name, config);
+        });
+    }
+}
+
 std::unique_ptr<TreeNode> BehaviorTreeFactory::instantiateTreeNode(
         const std::string& name,
         const std::string& ID,
@@ -152,16 +263,122 @@ std::unique_ptr<TreeNode> BehaviorTreeFactory::instantiateTreeNode(
     return node;
 }
 
+TreeNode::Ptr BehaviorTreeFactory::instantiateTreeNode(
+        const std::string& name,
+        const std::string& ID,
+        const NodeConfiguration& config,
+        const std::shared_ptr<NodeArena>& arena) const
+{
+    const TreeNodeRegistration* reg = arena ? registration(ID) : nullptr;
+    if (!reg || !reg->arena_builder)
+    {
+        return instantiateTreeNode(name, ID, config);
+    }
+
+    TreeNode* node = reg->arena_builder(*arena, name, config);
+    node->setRegistrationID( ID );
+    // the memory belongs to the arena: call the destructor only.
+    return TreeNode::Ptr(node, [arena](TreeNode* ptr) { ptr->~TreeNode(); });
+}
+
+void BehaviorTreeFactory::registerArenaBuilder(const std::string& ID,
+                                               const ArenaNodeBuilder& builder)
+{
+    if (builders_.count(ID) == 0)
+    {
+        throw BehaviorTreeException("registerArenaBuilder: ID [", ID, "] must be registered first");
+    }
+    arena_builders_[ID] = builder;
+    registrations_[ID].arena_builder = builder;
+}
+
+void BehaviorTreeFactory::enableNodeArena(bool enable)
+{
+    use_node_arena_ = enable;
+}
+
+bool BehaviorTreeFactory::nodeArenaEnabled() const
+{
+    return use_node_arena_;
+}
+
+void BehaviorTreeFactory::enableXMLVerification(bool enable)
+{
+    verify_xml_ = enable;
+}
+
+bool BehaviorTreeFactory::xmlVerificationEnabled() const
+{
+    return verify_xml_;
+}
+
+void BehaviorTreeFactory::setInstantiationThreads(unsigned threads)
+{
+    instantiation_threads_ = threads;
+}
+
+unsigned BehaviorTreeFactory::instantiationThreads() const
+{
+    return instantiation_threads_;
+}
+
+void BehaviorTreeFactory::enableLazySubtrees(bool enable, std::chrono::milliseconds idle_time)
+{
+    lazy_subtrees_ = enable;
+    subtree_idle_time_ = idle_time;
+}
+
+bool BehaviorTreeFactory::lazySubtreesEnabled() const
+{
+    return lazy_subtrees_;
+}
+
+std::chrono::milliseconds BehaviorTreeFactory::subtreeIdleTime() const
+{
+    return subtree_idle_time_;
+}
+
+void BehaviorTreeFactory::setXMLDocumentCache(std::shared_ptr<XMLDocumentCache> cache)
+{
+    document_cache_ = std::move(cache);
+}
+
+const std::shared_ptr<XMLDocumentCache>& BehaviorTreeFactory::xmlDocumentCache() const
+{
+    return document_cache_;
+}
+
+void BehaviorTreeFactory::setAsyncExecutor(std::shared_ptr<ThreadPool> executor)
+{
+    async_executor_ = std::move(executor);
+}
+
+const std::shared_ptr<ThreadPool>& BehaviorTreeFactory::asyncExecutor() const
+{
+    return async_executor_;
+}
+
 const std::unordered_map<std::string, NodeBuilder> &BehaviorTreeFactory::builders() const
 {
     return builders_;
 }
 
+const std::unordered_map<std::string, ArenaNodeBuilder> &BehaviorTreeFactory::arenaBuilders() const
+{
+    return arena_builders_;
+}
+
 const std::unordered_map<std::string,TreeNodeManifest>& BehaviorTreeFactory::manifests() const
 {
     return manifests_;
 }
 
+const TreeNodeRegistration* BehaviorTreeFactory::registration(const std::string& ID) const
+{
+    auto it = registrations_.find(ID);
+    return it != registrations_.end() ? &it->second : nullptr;
+}
+
 const std::set<std::string> &BehaviorTreeFactory::builtinNodes() const
 {
     return builtin_IDs_;
@@ -187,6 +404,451 @@ Tree BehaviorTreeFactory::createTreeFromFile(const std::string &file_path,
     return tree;
 }
 
+TreeBlueprint BehaviorTreeFactory::createBlueprintFromText(const std::string &text) const
+{
+    XMLParser parser(*this);
+    parser.loadFromText(text);
+    auto blueprint = parser.createBlueprint();
+    blueprint.def_->manifests = this->manifests();
+    return blueprint;
+}
+
+TreeBlueprint BehaviorTreeFactory::createBlueprintFromFile(const std::string &file_path) const
+{
+    XMLParser parser(*this);
+    parser.loadFromFile(file_path);
+    auto blueprint = parser.createBlueprint();
+    blueprint.def_->manifests = this->manifests();
+    return blueprint;
+}
+
+void TreeBlueprint::Definition::computeSubtreeRanges()
+{
+    // the nodes are stored depth-first: the descendants of a node follow it
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        nodes[i].subtree_end = i + 1;
+    }
+    for (size_t i = nodes.size(); i-- > 0; )
+    {
+        const int parent_index = nodes[i].parent_index;
+        if( parent_index >= 0 )
+        {
+            NodeRecord& parent = nodes[parent_index];
+            parent.subtree_end = std::max( parent.subtree_end, nodes[i].subtree_end );
+        }
+    }
+    size_t blackboard_index = 1;
+    for (NodeRecord& record: nodes)
+    {
+        record.subtree_blackboard = record.subtree ? blackboard_index++ : 0;
+    }
+}
+
+void TreeBlueprint::declarePorts(const NodeRecord& record, const Blackboard::Ptr& blackboard)
+{
+    // Initialize the ports in the BB to set the type
+    for (const PortDeclaration& port: record.port_declarations)
+    {
+        auto prev_info = blackboard->portInfo( port.key );
+        if( !prev_info  )
+        {
+            // not found, insert for the first time.
+            blackboard->setPortInfo( port.key, port.info );
+        }
+        else if( prev_info->type() && port.info.type()  && // null type means that everything is valid
+                 prev_info->type()!= port.info.type())
+        {
+            blackboard->debugMessage();
+
+            throw RuntimeError( "The creation of the tree failed because the port [", port.key,
+                               "] was initially created with type [", demangle( prev_info->type() ),
+                               "] and, later type [", demangle( port.info.type() ),
+                               "] was used somewhere else." );
+        }
+    }
+}
+
+void TreeBlueprint::parseInputConstants(NodeRecord& record,
+                                        const TreeNodeRegistration& registration)
+{
+    for (const auto& input: record.input_ports)
+    {
+        if( TreeNode::getRemappedKey(input.first, input.second) )
+        {
+            continue;
+        }
+        const TreeNodeRegistration::Port* port = registration.findPort(input.first.c_str());
+        if( !port )
+        {
+            continue;
+        }
+        try {
+            Any value = port->info.parseString(input.second);
+            if( !value.empty() )
+            {
+                record.input_constants.insert( { input.first, std::move(value) } );
+            }
+        }
+        catch( std::exception& )
+        {
+            // getInput() will fail, with the same error
+        }
+    }
+}
+
+TreeNode::Ptr TreeBlueprint::createNode(const Definition& def,
+                                        const NodeRecord& record,
+                                        uint16_t uid,
+                                        const Blackboard::Ptr& blackboard,
+                                        const std::shared_ptr<NodeArena>& arena,
+                                        const std::shared_ptr<WakeUpSignal>& wake_up,
+                                        const std::shared_ptr<FramePool>& frame_pool)
+{
+    // The UID is taken by the constructor of TreeNode. If the builder throws
+    // before it, the next node created by this thread must not get it.
+    struct PendingUIDGuard
+    {
+        explicit PendingUIDGuard(uint16_t uid)
+        {
+            TreeNode::setNextUID(uid);
+        }
+        ~PendingUIDGuard()
+        {
+            TreeNode::clearNextUID();
+        }
+    } uid_guard(uid);
+
+    TreeNode::Ptr node;
+    if( record.builder_index >= 0 )
+    {
+        NodeConfiguration config;
+        config.blackboard = blackboard;
+        config.input_ports = record.input_ports;
+        config.output_ports = record.output_ports;
+        config.input_constants = record.input_constants;
+        config.async_executor = def.async_executor;
+        config.wake_up = wake_up;
+        config.frame_pool = frame_pool;
+
+        const Builder& builder = def.builders[record.builder_index];
+        if( arena && builder.arena_builder )
+        {
+            TreeNode* ptr = builder.arena_builder(*arena, record.instance_name, config);
+            // the memory belongs to the arena: call the destructor only.
+            node = TreeNode::Ptr(ptr, [arena](TreeNode* p) { p->~TreeNode(); });
+        }
+        else{
+            node = builder.builder(record.instance_name, config);
+        }
+        node->setRegistrationID( builder.ID );
+    }
+    else
+    {
+        if( arena )
+        {
+            auto subtree = arena->create<DecoratorSubtreeNode>( record.instance_name );
+            node = TreeNode::Ptr(subtree, [arena](TreeNode* ptr) { ptr->~TreeNode(); });
+        }
+        else{
+            node = std::make_unique<DecoratorSubtreeNode>( record.instance_name );
+        }
+    }
+    return node;
+}
+
+Blackboard::Ptr TreeBlueprint::createBlackboard(const Definition& def, size_t index,
+                                                const Blackboard::Ptr& parent)
+{
+    // the remappings of the parent are added already: each chain is
+    // resolved here, once, to the Blackboard that owns the entry.
+    auto new_bb = Blackboard::create( parent );
+    for (const auto& remapping: def.blackboards[index].remappings)
+    {
+        new_bb->addSubtreeRemapping( remapping.first, remapping.second );
+    }
+    return new_bb;
+}
+
+namespace
+{
+void linkChild(TreeNode* parent, TreeNode* child)
+{
+    if (auto control_parent = dynamic_cast<ControlNode*>(parent))
+    {
+        control_parent->addChild(child);
+    }
+    if (auto decorator_parent = dynamic_cast<DecoratorNode*>(parent))
+    {
+        decorator_parent->setChild(child);
+    }
+}
+}
+
+void TreeBlueprint::createRange(const std::shared_ptr<const Definition>& def,
+                                size_t first, size_t last, size_t first_blackboard,
+                                uint16_t first_uid,
+                                std::vector<TreeNode::Ptr>& nodes,
+                                std::vector<Blackboard::Ptr>& blackboards,
+                                const std::shared_ptr<NodeArena>& arena,
+                                bool lazy,
+                                const std::shared_ptr<SubtreeEvictionPolicy>& eviction,
+                                const std::shared_ptr<WakeUpSignal>& wake_up,
+                                const std::shared_ptr<FramePool>& frame_pool)
+{
+    size_t i = first;
+    while( i < last )
+    {
+        const NodeRecord& record = def->nodes[i];
+        const Blackboard::Ptr& node_bb = blackboards[record.blackboard_index - first_blackboard];
+        declarePorts( record, node_bb );
+        TreeNode::Ptr& node = nodes[i - first];
+        node = createNode( *def, record, static_cast<uint16_t>(first_uid + (i - first)),
+                           node_bb, arena, wake_up, frame_pool );
+
+        const int parent_index = record.parent_index;
+        // a parent outside the range is the lazy SubTree that owns the range
+        if( parent_index >= static_cast<int>(first) )
+        {
+            linkChild( nodes[parent_index - first].get(), node.get() );
+        }
+
+        if( !record.subtree )
+        {
+            i++;
+            continue;
+        }
+
+        auto subtree_node = dynamic_cast<DecoratorSubtreeNode*>(node.get());
+        if( !lazy || !subtree_node || record.subtree_end == i + 1 )
+        {
+            blackboards[record.subtree_blackboard - first_blackboard] =
+                createBlackboard( *def, record.subtree_blackboard, node_bb );
+            i++;
+            continue;
+        }
+
+        // lazy SubTree: its nodes and Blackboards are created by the first tick
+        const size_t subtree_index = i;
+        const Blackboard::Ptr parent_bb = node_bb;
+        const uint16_t subtree_first_uid = static_cast<uint16_t>(first_uid + (i + 1 - first));
+        subtree_node->setLazyBuilder( [def, subtree_index, parent_bb, subtree_first_uid,
+                                       eviction, wake_up, frame_pool]()
+        {
+            const NodeRecord& subtree = def->nodes[subtree_index];
+            const size_t range_first = subtree_index + 1;
+            const size_t range_last = subtree.subtree_end;
+
+            size_t blackboards_count = 1;
+            for (size_t n = range_first; n < range_last; n++)
+            {
+                blackboards_count += def->nodes[n].subtree ? 1 : 0;
+            }
+            std::vector<TreeNode::Ptr> range_nodes( range_last - range_first );
+            std::vector<Blackboard::Ptr> range_blackboards( blackboards_count );
+            range_blackboards[0] = createBlackboard( *def, subtree.subtree_blackboard, parent_bb );
+
+            createRange( def, range_first, range_last, subtree.subtree_blackboard,
+                         subtree_first_uid, range_nodes, range_blackboards, {}, true,
+                         eviction, wake_up, frame_pool );
+
+            DecoratorSubtreeNode::LazyContent content;
+            for (auto& range_node: range_nodes)
+            {
+                if( range_node )
+                {
+                    content.nodes.push_back( std::move(range_node) );
+                }
+            }
+            for (auto& range_bb: range_blackboards)
+            {
+                if( range_bb )
+                {
+                    content.blackboards.push_back( std::move(range_bb) );
+                }
+            }
+            return content;
+        }, eviction );
+        i = record.subtree_end;
+    }
+}
+
+Tree TreeBlueprint::instantiate(const Blackboard::Ptr& blackboard) const
+{
+    if( !blackboard )
+    {
+        throw RuntimeError("TreeBlueprint::instantiate needs a non-empty blackboard");
+    }
+    Tree output_tree;
+    output_tree.manifests = def_->manifests;
+    output_tree.wake_up = std::make_shared<WakeUpSignal>();
+#ifdef BT_CPP20_COROUTINES
+    output_tree.frame_pool = std::make_shared<FramePool>();
+#endif
+    if( use_node_arena_ )
+    {
+        output_tree.arena = std::make_shared<NodeArena>();
+    }
+    if( lazy_subtrees_ && subtree_idle_time_.count() > 0 )
+    {
+        output_tree.subtree_eviction = std::make_shared<SubtreeEvictionPolicy>( subtree_idle_time_ );
+    }
+
+    std::vector<TreeNode::Ptr> nodes( def_->nodes.size() );
+    std::vector<Blackboard::Ptr> blackboards( def_->blackboards.size() );
+    blackboards[0] = blackboard;
+
+    if( lazy_subtrees_ || instantiation_threads_ <= 1 || def_->blackboards.size() <= 1 )
+    {
+        // the UID of a node depends only on its position in the definition
+        const uint16_t first_uid = TreeNode::reserveUIDs( nodes.size() );
+        createRange( def_, 0, nodes.size(), 0, first_uid, nodes, blackboards, output_tree.arena,
+                     lazy_subtrees_, output_tree.subtree_eviction, output_tree.wake_up,
+                     output_tree.frame_pool );
+    }
+    else
+    {
+        createNodesConcurrently( nodes, blackboards, output_tree.arena, output_tree.wake_up,
+                                 output_tree.frame_pool );
+    }
+
+    // the lazy SubTrees leave holes
+    output_tree.nodes.reserve( nodes.size() );
+    for (auto& node: nodes)
+    {
+        if( node )
+        {
+            output_tree.nodes.push_back( std::move(node) );
+        }
+    }
+    output_tree.blackboard_stack.reserve( blackboards.size() );
+    for (auto& bb: blackboards)
+    {
+        if( bb )
+        {
+            output_tree.blackboard_stack.push_back( std::move(bb) );
+        }
+    }
+
+    if( output_tree.nodes.size() > 0)
+    {
+        output_tree.root_node = output_tree.nodes.front().get();
+    }
+    return output_tree;
+}
+
+void TreeBlueprint::createNodesConcurrently(std::vector<TreeNode::Ptr>& nodes,
+                                            std::vector<Blackboard::Ptr>& blackboards,
+                                            const std::shared_ptr<NodeArena>& arena,
+                                            const std::shared_ptr<WakeUpSignal>& wake_up,
+                                            const std::shared_ptr<FramePool>& frame_pool) const
+{
+    const Definition& def = *def_;
+    const uint16_t first_uid = TreeNode::reserveUIDs( def.nodes.size() );
+
+    // The Blackboards and the types of the ports are created first, in order.
+    // Then there is a task for each Blackboard, i.e. the main tree and each SubTree,
+    // that creates its nodes.
+    std::vector<std::vector<size_t>> tasks( def.blackboards.size() );
+    for (size_t i = 0; i < def.nodes.size(); i++)
+    {
+        const NodeRecord& record = def.nodes[i];
+        declarePorts( record, blackboards[record.blackboard_index] );
+        if( record.subtree )
+        {
+            blackboards[record.subtree_blackboard] =
+                createBlackboard( def, record.subtree_blackboard, blackboards[record.blackboard_index] );
+        }
+        tasks[record.blackboard_index].push_back(i);
+    }
+
+    // NodeArena is not thread-safe: one for each task. The first one is
+    // Tree::arena, the others are kept alive by their nodes.
+    std::vector<std::shared_ptr<NodeArena>> arenas( tasks.size() );
+    if( arena )
+    {
+        arenas[0] = arena;
+        for (size_t t = 1; t < tasks.size(); t++)
+        {
+            if( !tasks[t].empty() )
+            {
+                arenas[t] = std::make_shared<NodeArena>();
+            }
+        }
+    }
+
+    std::atomic<size_t> next_task(0);
+    std::vector<std::exception_ptr> errors( tasks.size() );
+
+    auto worker = [&]()
+    {
+        for (size_t t = next_task++; t < tasks.size(); t = next_task++)
+        {
+            try {
+                for (size_t i: tasks[t])
+                {
+                    const NodeRecord& record = def.nodes[i];
+                    nodes[i] = createNode( def, record, static_cast<uint16_t>(first_uid + i),
+                                           blackboards[record.blackboard_index],
+                                           arenas[t], wake_up, frame_pool );
+                }
+            }
+            catch(...)
+            {
+                errors[t] = std::current_exception();
+            }
+        }
+    };
+
+    const size_t threads_count = std::min<size_t>( instantiation_threads_, tasks.size() );
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_count; i++)
+    {
+        threads.emplace_back( worker );
+    }
+    worker();
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    // report the same error that a serial instantiation would
+    std::exception_ptr first_error;
+    size_t first_error_node = def.nodes.size();
+    for (size_t t = 0; t < tasks.size(); t++)
+    {
+        if( errors[t] )
+        {
+            for (size_t i: tasks[t])
+            {
+                if( !nodes[i] )
+                {
+                    if( i < first_error_node )
+                    {
+                        first_error_node = i;
+                        first_error = errors[t];
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    if( first_error )
+    {
+        std::rethrow_exception( first_error );
+    }
+
+    // link the nodes, in the original order
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        const int parent_index = def.nodes[i].parent_index;
+        if( parent_index >= 0 )
+        {
+            linkChild( nodes[parent_index].get(), nodes[i].get() );
+        }
+    }
+}
+
 Tree::~Tree()
 {
     if (root_node) {
@@ -203,5 +865,49 @@ Blackboard::Ptr Tree::rootBlackboard()
     return {};
 }
 
+size_t Tree::evictIdleSubtrees()
+{
+    return subtree_eviction ? subtree_eviction->evictIdleSubtrees() : 0;
+}
+
+bool Tree::sleep(std::chrono::steady_clock::duration timeout)
+{
+    if( !wake_up )
+    {
+        std::this_thread::sleep_for( timeout );
+        return false;
+    }
+    return wake_up->waitFor( timeout );
+}
+
+void Tree::watchBlackboardEntry(const std::string& key)
+{
+    auto blackboard = rootBlackboard();
+    if( !blackboard )
+    {
+        throw RuntimeError("Tree::watchBlackboardEntry: the tree has no Blackboard");
+    }
+    if( !wake_up )
+    {
+        wake_up = std::make_shared<WakeUpSignal>();
+    }
+    blackboard->watchEntry( key, wake_up );
+}
+
+NodeStatus Tree::tickWhileRunning(std::chrono::milliseconds max_sleep)
+{
+    if( !root_node )
+    {
+        throw RuntimeError("Tree::tickWhileRunning: the tree is empty");
+    }
+    NodeStatus status = root_node->executeTick();
+    while( status == NodeStatus::RUNNING )
+    {
+        sleep( max_sleep );
+        status = root_node->executeTick();
+    }
+    return status;
+}
+
 
 }   // end namespace
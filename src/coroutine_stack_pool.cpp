@@ -0,0 +1,222 @@
+#include "behaviortree_cpp_v3/utils/coroutine_stack_pool.h"
+#include "behaviortree_cpp_v3/exceptions.h"
+#include <algorithm>
+#include <map>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace BT
+{
+constexpr size_t CoroutineStackPool::DEFAULT_STACK_SIZE;
+
+namespace
+{
+size_t systemPageSize()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+struct NodeTypePools
+{
+    std::mutex mutex;
+    std::map<std::pair<std::string, size_t>, std::shared_ptr<CoroutineStackPool>> pools;
+};
+
+NodeTypePools& nodeTypePools()
+{
+    static NodeTypePools instance;
+    return instance;
+}
+}
+
+CoroutineStackPool::CoroutineStackPool(size_t stack_size)
+  : page_size_(systemPageSize()),
+    unmapped_high_water_(0)
+{
+    if( stack_size == 0 )
+    {
+        throw RuntimeError("CoroutineStackPool: the stack size can't be 0");
+    }
+    stack_size_ = ((stack_size + page_size_ - 1) / page_size_) * page_size_;
+}
+
+CoroutineStackPool::~CoroutineStackPool()
+{
+    for (const auto& stack: stacks_)
+    {
+        unmapStack(stack);
+    }
+}
+
+CoroutineStackPool::Stack CoroutineStackPool::acquire()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if( !free_stacks_.empty() )
+        {
+            Stack stack = free_stacks_.back();
+            free_stacks_.pop_back();
+            return stack;
+        }
+    }
+
+#ifdef _WIN32
+    // CoroActionNode uses fibers, that allocate their own stack
+    throw RuntimeError("CoroutineStackPool: not available on Windows");
+#else
+    // the guard page is the lowest one
+    const size_t mapped_size = stack_size_ + page_size_;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_STACK
+    flags |= MAP_STACK;
+#endif
+    void* memory = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if( memory == MAP_FAILED )
+    {
+        throw RuntimeError("CoroutineStackPool: can't map a stack of ",
+                           std::to_string(stack_size_), " bytes");
+    }
+    char* base = static_cast<char*>(memory);
+    if( mprotect(base, page_size_, PROT_NONE) != 0 )
+    {
+        munmap(base, mapped_size);
+        throw RuntimeError("CoroutineStackPool: can't protect the guard page of a stack");
+    }
+
+    Stack stack;
+    stack.data = base + page_size_;
+    stack.size = stack_size_;
+    std::unique_lock<std::mutex> lock(mutex_);
+    stacks_.push_back(stack);
+    return stack;
+#endif
+}
+
+void CoroutineStackPool::release(Stack stack)
+{
+    if( !stack.data )
+    {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    free_stacks_.push_back(stack);
+}
+
+size_t CoroutineStackPool::stacksCount() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return stacks_.size();
+}
+
+size_t CoroutineStackPool::highWaterMark() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    size_t high_water = unmapped_high_water_;
+    for (const auto& stack: stacks_)
+    {
+        high_water = std::max( high_water, measureStack(stack) );
+    }
+    return high_water;
+}
+
+void CoroutineStackPool::shrink()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (const auto& stack: free_stacks_)
+    {
+        unmapped_high_water_ = std::max( unmapped_high_water_, measureStack(stack) );
+        unmapStack(stack);
+        stacks_.erase( std::find_if( stacks_.begin(), stacks_.end(),
+                                     [&stack](const Stack& s) { return s.data == stack.data; } ) );
+    }
+    free_stacks_.clear();
+}
+
+size_t CoroutineStackPool::measureStack(const Stack& stack) const
+{
+#ifdef _WIN32
+    (void)stack;
+    return 0;
+#else
+    // the pages never touched are not resident: find the lowest one that is.
+    // The ones swapped out are not resident either: the result is a lower bound.
+    const size_t pages = stack.size / page_size_;
+#if defined(__APPLE__)
+    std::vector<char> resident(pages);
+#else
+    std::vector<unsigned char> resident(pages);
+#endif
+    if( mincore(stack.data, stack.size, resident.data()) != 0 )
+    {
+        return 0;
+    }
+    for (size_t i = 0; i < pages; i++)
+    {
+        if( resident[i] & 1 )
+        {
+            return stack.size - i * page_size_;
+        }
+    }
+    return 0;
+#endif
+}
+
+void CoroutineStackPool::unmapStack(const Stack& stack)
+{
+#ifdef _WIN32
+    (void)stack;
+#else
+    munmap(stack.data - page_size_, stack.size + page_size_);
+#endif
+}
+
+std::shared_ptr<CoroutineStackPool> CoroutineStackPool::forNodeType(const std::string& node_type,
+                                                                    size_t stack_size)
+{
+    auto& registry = nodeTypePools();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+    auto& pool = registry.pools[ std::make_pair(node_type, stack_size) ];
+    if( !pool )
+    {
+        pool = std::make_shared<CoroutineStackPool>(stack_size);
+    }
+    return pool;
+}
+
+std::vector<CoroutineStackPool::Report> CoroutineStackPool::reportNodeTypes()
+{
+    auto& registry = nodeTypePools();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+    std::vector<Report> reports;
+    reports.reserve( registry.pools.size() );
+    for (const auto& it: registry.pools)
+    {
+        const auto& pool = it.second;
+        reports.push_back( { it.first.first, pool->stackSize(),
+                             pool->stacksCount(), pool->highWaterMark() } );
+    }
+    return reports;
+}
+
+void CoroutineStackPool::shrinkNodeTypes()
+{
+    auto& registry = nodeTypePools();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+    for (const auto& it: registry.pools)
+    {
+        it.second->shrink();
+    }
+}
+
+}   // end namespace
@@ -1,4 +1,7 @@
 #include "behaviortree_cpp_v3/decorators/subtree_node.h"
+#include "behaviortree_cpp_v3/behavior_tree.h"
+
+#include <algorithm>
 
 
 BT::DecoratorSubtreeNode::DecoratorSubtreeNode(const std::string &name) :
@@ -7,6 +10,52 @@ BT::DecoratorSubtreeNode::DecoratorSubtreeNode(const std::string &name) :
     setRegistrationID("SubTree");
 }
 
+BT::DecoratorSubtreeNode::~DecoratorSubtreeNode()
+{
+    if( eviction_ && child_node_ )
+    {
+        eviction_->remove(this);
+    }
+}
+
+void BT::DecoratorSubtreeNode::setLazyBuilder(LazyBuilder builder,
+                                              std::shared_ptr<SubtreeEvictionPolicy> eviction)
+{
+    lazy_builder_ = std::move(builder);
+    eviction_ = std::move(eviction);
+}
+
+bool BT::DecoratorSubtreeNode::releaseLazyContent()
+{
+    if( !lazy_builder_ || status() == NodeStatus::RUNNING )
+    {
+        return false;
+    }
+    if( child_node_ )
+    {
+        haltAllActions(child_node_);
+        child_node_ = nullptr;
+        if( eviction_ )
+        {
+            eviction_->remove(this);
+        }
+    }
+    // the lazy SubTrees inside this one remove themselves from eviction_
+    LazyContent content = std::move(lazy_content_);
+    lazy_content_ = LazyContent();
+    content.nodes.clear();
+    return true;
+}
+
+void BT::DecoratorSubtreeNode::halt()
+{
+    if( child_node_ )
+    {
+        haltChild();
+    }
+    setStatus(NodeStatus::IDLE);
+}
+
 BT::NodeStatus BT::DecoratorSubtreeNode::tick()
 {
     NodeStatus prev_status = status();
@@ -14,6 +63,77 @@ BT::NodeStatus BT::DecoratorSubtreeNode::tick()
     {
         setStatus(NodeStatus::RUNNING);
     }
-    return child_node_->executeTick();
+
+    if( lazy_builder_ )
+    {
+        if( eviction_ )
+        {
+            eviction_->periodicCheck( std::chrono::steady_clock::now() );
+        }
+        if( !child_node_ )
+        {
+            lazy_content_ = lazy_builder_();
+            child_node_ = lazy_content_.nodes.front().get();
+            if( eviction_ )
+            {
+                eviction_->add(this);
+            }
+        }
+    }
+    const NodeStatus child_status = child_node_->executeTick();
+    if( lazy_builder_ )
+    {
+        // the idle time starts when the tick is completed
+        last_tick_ = std::chrono::steady_clock::now();
+    }
+    return child_status;
+}
+
+BT::SubtreeEvictionPolicy::SubtreeEvictionPolicy(std::chrono::milliseconds idle_time):
+  idle_time_(idle_time),
+  last_check_( std::chrono::steady_clock::now() )
+{
+}
+
+size_t BT::SubtreeEvictionPolicy::evictIdleSubtrees()
+{
+    const auto now = std::chrono::steady_clock::now();
+    last_check_ = now;
+
+    size_t count = 0;
+    size_t index = 0;
+    while( index < subtrees_.size() )
+    {
+        DecoratorSubtreeNode* subtree = subtrees_[index];
+        if( subtree->status() != NodeStatus::RUNNING &&
+            now - subtree->last_tick_ > idle_time_ &&
+            subtree->releaseLazyContent() )
+        {
+            count++;
+            // the nested SubTrees were removed too: start again
+            index = 0;
+        }
+        else {
+            index++;
+        }
+    }
+    return count;
+}
+
+void BT::SubtreeEvictionPolicy::periodicCheck(std::chrono::steady_clock::time_point now)
+{
+    if( now - last_check_ > idle_time_ / 2 )
+    {
+        evictIdleSubtrees();
+    }
 }
 
+void BT::SubtreeEvictionPolicy::add(DecoratorSubtreeNode* subtree)
+{
+    subtrees_.push_back(subtree);
+}
+
+void BT::SubtreeEvictionPolicy::remove(DecoratorSubtreeNode* subtree)
+{
+    subtrees_.erase( std::remove(subtrees_.begin(), subtrees_.end(), subtree), subtrees_.end() );
+}
@@ -17,7 +17,8 @@ namespace BT
 
 TimeoutNode::TimeoutNode(const std::string& name, unsigned milliseconds)
   : DecoratorNode(name, {} ),
-  child_halted_(false),
+  timer_service_(TimerService::global()),
+  timed_out_(false),
   timer_id_(0),
   msec_(milliseconds),
   read_parameter_from_ports_(false),
@@ -28,7 +29,8 @@ TimeoutNode::TimeoutNode(const std::string& name, unsigned milliseconds)
 
 TimeoutNode::TimeoutNode(const std::string& name, const NodeConfiguration& config)
   : DecoratorNode(name, config),
-    child_halted_(false),
+    timer_service_(TimerService::global()),
+    timed_out_(false),
     timer_id_(0),
     msec_(0),
     read_parameter_from_ports_(true),
@@ -50,43 +52,45 @@ NodeStatus TimeoutNode::tick()
     {
         timeout_started_ = true;
         setStatus(NodeStatus::RUNNING);
-        child_halted_ = false;
+        timed_out_ = false;
 
         if (msec_ > 0)
         {
-            timer_id_ = timer_.add(std::chrono::milliseconds(msec_),
-                                    [this](bool aborted)
+            // executed by the thread shared by all the timers: keep it short,
+            // the child is halted by the thread that ticks the tree.
+            timer_id_ = timer_service_->add(std::chrono::milliseconds(msec_),
+                                            [this]()
             {
-                std::unique_lock<std::mutex> lk( timeout_mutex_ );
-                if (!aborted && child()->status() == NodeStatus::RUNNING)
+                if (child()->status() == NodeStatus::RUNNING)
                 {
-                    child_halted_ = true;
-                    child()->halt();
-                    child()->setStatus(NodeStatus::IDLE);
+                    timed_out_ = true;
+                    emitWakeUpSignal();
                 }
             });
         }
     }
 
-    std::unique_lock<std::mutex> lk( timeout_mutex_ );
-
-    if (child_halted_)
+    if (timed_out_)
     {
         timeout_started_ = false;
+        haltChild();
         return NodeStatus::FAILURE;
     }
-    else
+
+    auto child_status = child()->executeTick();
+    if (child_status != NodeStatus::RUNNING)
     {
-        auto child_status = child()->executeTick();
-        if (child_status != NodeStatus::RUNNING)
-        {
-            timeout_started_ = false;
-            timeout_mutex_.unlock();
-            timer_.cancel(timer_id_);
-            timeout_mutex_.lock();
-        }
-        return child_status;
+        timeout_started_ = false;
+        timer_service_->cancel(timer_id_);
     }
+    return child_status;
+}
+
+void TimeoutNode::halt()
+{
+    timer_service_->cancel(timer_id_);
+    timeout_started_ = false;
+    DecoratorNode::halt();
 }
 
 }
@@ -11,7 +11,7 @@ SharedLibrary::SharedLibrary()
     _handle = nullptr;
 }
 
-void SharedLibrary::load(const std::string& path, int)
+void SharedLibrary::load(const std::string& path, int flags)
 {
     std::unique_lock<std::mutex> lock(_mutex);
 
@@ -20,7 +20,9 @@ void SharedLibrary::load(const std::string& path, int)
         throw RuntimeError("Library already loaded: " + path);
     }
 
-    _handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    int dl_flags = (flags & SHLIB_LOCAL) ? RTLD_LOCAL : RTLD_GLOBAL;
+    dl_flags |= (flags & SHLIB_LAZY) ? RTLD_LAZY : RTLD_NOW;
+    _handle = dlopen(path.c_str(), dl_flags);
     if (!_handle)
     {
         const char* err = dlerror();
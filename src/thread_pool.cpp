@@ -0,0 +1,82 @@
+#include "behaviortree_cpp_v3/utils/thread_pool.h"
+#include <algorithm>
+
+namespace BT
+{
+ThreadPool::ThreadPool(size_t max_threads)
+  : max_threads_(max_threads),
+    idle_threads_(0),
+    stop_(false)
+{
+    if( max_threads_ == 0 )
+    {
+        max_threads_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    task_signal_.notify_all();
+    for (auto& thread: threads_)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::post(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    tasks_.push_back( std::move(task) );
+    // the idle threads might be already notified by the previous tasks
+    if( idle_threads_ < tasks_.size() && threads_.size() < max_threads_ )
+    {
+        threads_.emplace_back( &ThreadPool::workerLoop, this );
+        return;
+    }
+    lock.unlock();
+    task_signal_.notify_one();
+}
+
+size_t ThreadPool::threadsCount() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return threads_.size();
+}
+
+size_t ThreadPool::pendingTasks() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+void ThreadPool::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while( true )
+    {
+        if( tasks_.empty() )
+        {
+            if( stop_ )
+            {
+                return;
+            }
+            idle_threads_++;
+            task_signal_.wait(lock);
+            idle_threads_--;
+            continue;
+        }
+        std::function<void()> task = std::move( tasks_.front() );
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        // destroy what the task captured without holding the lock
+        task = nullptr;
+        lock.lock();
+    }
+}
+
+}   // end namespace
@@ -0,0 +1,217 @@
+#include "behaviortree_cpp_v3/utils/timer_service.h"
+
+namespace BT
+{
+namespace
+{
+uint64_t makeID(uint32_t generation, uint32_t slot)
+{
+    return (uint64_t(generation) << 32) | slot;
+}
+}
+
+TimerService::TimerService()
+  : running_id_(0),
+    stop_(false)
+{
+}
+
+TimerService::~TimerService()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_signal_.notify_all();
+    if( thread_.joinable() )
+    {
+        thread_.join();
+    }
+}
+
+const std::shared_ptr<TimerService>& TimerService::global()
+{
+    static const std::shared_ptr<TimerService> service = std::make_shared<TimerService>();
+    return service;
+}
+
+uint64_t TimerService::add(std::chrono::milliseconds delay, std::function<void()> handler)
+{
+    const auto deadline = Clock::now() + delay;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if( !thread_.joinable() )
+    {
+        thread_ = std::thread(&TimerService::run, this);
+    }
+
+    uint32_t slot;
+    if( free_slots_.empty() )
+    {
+        slot = static_cast<uint32_t>( slots_.size() );
+        slots_.emplace_back();
+    }
+    else{
+        slot = free_slots_.back();
+        free_slots_.pop_back();
+    }
+    slots_[slot].handler = std::move(handler);
+    slots_[slot].heap_index = static_cast<uint32_t>( heap_.size() );
+    heap_.push_back( {deadline, slot} );
+    siftUp( heap_.size() - 1 );
+
+    const uint64_t id = makeID( slots_[slot].generation, slot );
+    // the thread must wait less only if this is the first timer to expire
+    const bool is_first = ( heap_.front().slot == slot );
+    lock.unlock();
+    if( is_first )
+    {
+        work_signal_.notify_one();
+    }
+    return id;
+}
+
+bool TimerService::cancel(uint64_t id)
+{
+    const uint32_t slot = static_cast<uint32_t>( id & 0xFFFFFFFF );
+    const uint32_t generation = static_cast<uint32_t>( id >> 32 );
+
+    std::function<void()> handler;
+    std::unique_lock<std::mutex> lock(mutex_);
+    if( slot >= slots_.size() || slots_[slot].generation != generation )
+    {
+        // expired already: wait for the handler, unless this is the handler
+        if( std::this_thread::get_id() != thread_.get_id() )
+        {
+            while( id != 0 && running_id_ == id )
+            {
+                done_signal_.wait(lock);
+            }
+        }
+        return false;
+    }
+    removeFromHeap( slots_[slot].heap_index );
+    handler = releaseSlot( slot );
+    lock.unlock();
+    // the handler is destroyed without holding the lock
+    return true;
+}
+
+size_t TimerService::size() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return heap_.size();
+}
+
+void TimerService::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while( !stop_ )
+    {
+        if( heap_.empty() )
+        {
+            work_signal_.wait(lock);
+            continue;
+        }
+        const HeapEntry first = heap_.front();
+        if( Clock::now() < first.deadline )
+        {
+            work_signal_.wait_until(lock, first.deadline);
+            continue;
+        }
+        removeFromHeap( 0 );
+        running_id_ = makeID( slots_[first.slot].generation, first.slot );
+        std::function<void()> handler = releaseSlot( first.slot );
+
+        lock.unlock();
+        handler();
+        handler = nullptr;
+        lock.lock();
+
+        running_id_ = 0;
+        done_signal_.notify_all();
+    }
+}
+
+void TimerService::siftUp(size_t index)
+{
+    const HeapEntry entry = heap_[index];
+    while( index > 0 )
+    {
+        const size_t parent = (index - 1) / 2;
+        if( !(entry.deadline < heap_[parent].deadline) )
+        {
+            break;
+        }
+        heap_[index] = heap_[parent];
+        slots_[ heap_[index].slot ].heap_index = static_cast<uint32_t>(index);
+        index = parent;
+    }
+    heap_[index] = entry;
+    slots_[ entry.slot ].heap_index = static_cast<uint32_t>(index);
+}
+
+void TimerService::siftDown(size_t index)
+{
+    const HeapEntry entry = heap_[index];
+    const size_t count = heap_.size();
+    while( true )
+    {
+        size_t child = 2 * index + 1;
+        if( child >= count )
+        {
+            break;
+        }
+        if( child + 1 < count && heap_[child + 1].deadline < heap_[child].deadline )
+        {
+            child++;
+        }
+        if( !(heap_[child].deadline < entry.deadline) )
+        {
+            break;
+        }
+        heap_[index] = heap_[child];
+        slots_[ heap_[index].slot ].heap_index = static_cast<uint32_t>(index);
+        index = child;
+    }
+    heap_[index] = entry;
+    slots_[ entry.slot ].heap_index = static_cast<uint32_t>(index);
+}
+
+void TimerService::removeFromHeap(size_t index)
+{
+    const size_t last = heap_.size() - 1;
+    if( index != last )
+    {
+        heap_[index] = heap_[last];
+        heap_.pop_back();
+        // the entry moved from the back can be earlier than the new parent
+        // or later than the new children
+        if( index > 0 && heap_[index].deadline < heap_[(index - 1) / 2].deadline )
+        {
+            siftUp( index );
+        }
+        else{
+            siftDown( index );
+        }
+    }
+    else{
+        heap_.pop_back();
+    }
+}
+
+std::function<void()> TimerService::releaseSlot(uint32_t slot)
+{
+    Slot& entry = slots_[slot];
+    std::function<void()> handler = std::move(entry.handler);
+    entry.handler = nullptr;
+    entry.generation++;
+    if( entry.generation == 0 )
+    {
+        entry.generation = 1; // 0 is never a valid generation
+    }
+    free_slots_.push_back(slot);
+    return handler;
+}
+
+}   // end namespace
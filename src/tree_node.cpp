@@ -12,19 +12,122 @@
 */
 
 #include "behaviortree_cpp_v3/tree_node.h"
+#include "behaviortree_cpp_v3/utils/wakeup_signal.h"
 #include <cstring>
+#include <climits>
+#include <limits>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace BT
 {
+namespace
+{
+std::atomic<uint16_t> next_uid(1);
+
+// set by TreeNode::setNextUID(), -1 if not used.
+thread_local int32_t pending_uid = -1;
+}
+
 static uint16_t getUID()
 {
-    static uint16_t uid = 1;
-    return uid++;
+    if (pending_uid >= 0)
+    {
+        const auto uid = static_cast<uint16_t>(pending_uid);
+        pending_uid = -1;
+        return uid;
+    }
+    return next_uid++;
+}
+
+uint16_t TreeNode::reserveUIDs(size_t count)
+{
+    if (count > std::numeric_limits<uint16_t>::max())
+    {
+        throw RuntimeError("TreeNode::reserveUIDs: can't reserve ", std::to_string(count),
+                           " UIDs, the limit is ",
+                           std::to_string(std::numeric_limits<uint16_t>::max()));
+    }
+    return next_uid.fetch_add(static_cast<uint16_t>(count));
+}
+
+void TreeNode::setNextUID(uint16_t uid)
+{
+    pending_uid = uid;
+}
+
+void TreeNode::clearNextUID()
+{
+    pending_uid = -1;
+}
+
+namespace
+{
+static_assert(sizeof(std::atomic<NodeStatus>) == sizeof(int),
+              "the status word must be usable as a futex");
+
+#ifdef __linux__
+
+// Sleep until the status word is different from "old_value".
+// Spurious wake-ups are allowed: the caller must check again.
+void waitOnStatus(const std::atomic<NodeStatus>* addr, NodeStatus old_value)
+{
+    syscall(SYS_futex, reinterpret_cast<const int*>(addr), FUTEX_WAIT_PRIVATE,
+            static_cast<int>(old_value), nullptr, nullptr, 0);
+}
+
+void wakeAllOnStatus(const std::atomic<NodeStatus>* addr)
+{
+    syscall(SYS_futex, reinterpret_cast<const int*>(addr), FUTEX_WAKE_PRIVATE,
+            INT_MAX, nullptr, nullptr, 0);
+}
+
+#else
+
+// Portable fallback: a small table of mutex/condition_variable pairs,
+// selected by address (same idea as the "parking lot" of std::atomic::wait).
+struct StatusWaitBucket
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+StatusWaitBucket& statusWaitBucket(const void* addr)
+{
+    static StatusWaitBucket buckets[16];
+    return buckets[(reinterpret_cast<uintptr_t>(addr) >> 4) % 16];
+}
+
+void waitOnStatus(const std::atomic<NodeStatus>* addr, NodeStatus old_value)
+{
+    auto& bucket = statusWaitBucket(addr);
+    std::unique_lock<std::mutex> lock(bucket.mutex);
+    if (addr->load() == old_value)
+    {
+        bucket.cv.wait(lock);
+    }
+}
+
+void wakeAllOnStatus(const std::atomic<NodeStatus>* addr)
+{
+    auto& bucket = statusWaitBucket(addr);
+    {
+        std::lock_guard<std::mutex> lock(bucket.mutex);
+    }
+    bucket.cv.notify_all();
+}
+
+#endif
 }
 
 TreeNode::TreeNode(std::string name, NodeConfiguration config)
   : name_(std::move(name)),
     status_(NodeStatus::IDLE),
+    status_waiters_(0),
     uid_(getUID()),
     config_(std::move(config))
 {
@@ -39,35 +142,61 @@ NodeStatus TreeNode::executeTick()
 
 void TreeNode::setStatus(NodeStatus new_status)
 {
-    NodeStatus prev_status;
+    const NodeStatus prev_status = status_.exchange(new_status);
+
+    if (prev_status != new_status)
     {
-        std::unique_lock<std::mutex> UniqueLock(state_mutex_);
-        prev_status = status_;
-        status_ = new_status;
+        if (status_waiters_.load() != 0)
+        {
+            wakeAllOnStatus(&status_);
+        }
+        // Loggers are often not attached at all: don't even read the clock.
+        if (state_change_signal_.hasSubscribers())
+        {
+            state_change_signal_.notify(std::chrono::high_resolution_clock::now(), *this,
+                                        prev_status, new_status);
+        }
     }
-    if (prev_status != new_status)
+}
+
+void TreeNode::emitWakeUpSignal() const
+{
+    if (config_.wake_up)
     {
-        state_condition_variable_.notify_all();
-        state_change_signal_.notify(std::chrono::high_resolution_clock::now(), *this, prev_status,
-                                    new_status);
+        config_.wake_up->emitSignal();
+    }
+}
+
+void TreeNode::requestWakeUp(std::chrono::steady_clock::duration delay) const
+{
+    if (config_.wake_up)
+    {
+        config_.wake_up->requestWakeUpAt(std::chrono::steady_clock::now() + delay);
     }
 }
 
 NodeStatus TreeNode::status() const
 {
-    std::lock_guard<std::mutex> lock(state_mutex_);
-    return status_;
+    return status_.load(std::memory_order_acquire);
 }
 
 NodeStatus TreeNode::waitValidStatus()
 {
-    std::unique_lock<std::mutex> lock(state_mutex_);
+    NodeStatus current = status_.load();
+    if (current != NodeStatus::IDLE)
+    {
+        return current;
+    }
 
-    while( isHalted() )
+    status_waiters_.fetch_add(1);
+    // Check again after registering as a waiter, otherwise a concurrent
+    // setStatus() might skip the wake-up.
+    while ((current = status_.load()) == NodeStatus::IDLE)
     {
-        state_condition_variable_.wait(lock);
+        waitOnStatus(&status_, NodeStatus::IDLE);
     }
-    return status_;
+    status_waiters_.fetch_sub(1);
+    return current;
 }
 
 const std::string& TreeNode::name() const
@@ -77,7 +206,7 @@ const std::string& TreeNode::name() const
 
 bool TreeNode::isHalted() const
 {
-    return status_ == NodeStatus::IDLE;
+    return status() == NodeStatus::IDLE;
 }
 
 TreeNode::StatusChangeSubscriber
@@ -152,6 +281,7 @@ void TreeNode::modifyPortsRemapping(const PortsRemapping &new_remapping)
         if( it != config_.input_ports.end() )
         {
             it->second = new_it.second;
+            config_.input_constants.erase( new_it.first );
         }
         it = config_.output_ports.find( new_it.first );
         if( it != config_.output_ports.end() )
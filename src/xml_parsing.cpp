@@ -12,6 +12,9 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <mutex>
+#include <sys/stat.h>
 
 #if defined(__linux) || defined(__linux__)
 	#pragma GCC diagnostic push
@@ -37,21 +40,40 @@ namespace BT
 {
 using namespace BT_TinyXML2;
 
+namespace
+{
+// Same as VerifyXML, but the document is parsed already.
+void VerifyXMLDocument(const BT_TinyXML2::XMLDocument& doc,
+                       const std::set<std::string>& registered_nodes);
+}
+
 struct XMLParser::Pimpl
 {
-    TreeNode::Ptr createNodeFromXML(const XMLElement* element,
-                                    const Blackboard::Ptr& blackboard,
-                                    const TreeNode::Ptr& node_parent);
+    // Add to the blueprint the node described by element.
+    // Return the index of the new NodeRecord.
+    int compileNodeFromXML(const XMLElement* element,
+                           size_t blackboard_index,
+                           int parent_index,
+                           TreeBlueprint& blueprint);
+
+    void recursivelyCompileTree(const std::string& tree_ID,
+                                TreeBlueprint& blueprint,
+                                size_t blackboard_index,
+                                int root_parent_index);
 
-    void recursivelyCreateTree(const std::string& tree_ID,
-                               Tree& output_tree,
-                               Blackboard::Ptr blackboard,
-                               const TreeNode::Ptr& root_parent);
+    // index of the builder of the registration in the blueprint, added if needed
+    int builderIndex(const TreeNodeRegistration& registration, TreeBlueprint& blueprint);
 
-    void loadDocImpl(BT_TinyXML2::XMLDocument* doc);
+    void loadDocImpl(const BT_TinyXML2::XMLDocument* doc);
 
-    std::list<std::unique_ptr<BT_TinyXML2::XMLDocument> > opened_documents;
+    // Parse the file, or take it from the cache of the factory.
+    // Return null if this parser loaded it already.
+    std::shared_ptr<const BT_TinyXML2::XMLDocument> openFile(const filesystem::path& file_path);
+
+    std::list<std::shared_ptr<const BT_TinyXML2::XMLDocument> > opened_documents;
     std::unordered_map<std::string,const XMLElement*>  tree_roots;
+    // absolute paths of the files in opened_documents
+    std::set<std::string> opened_files;
 
     const BehaviorTreeFactory& factory;
 
@@ -70,6 +92,7 @@ struct XMLParser::Pimpl
         suffix_count = 0;
         current_path = filesystem::path::getcwd();
         opened_documents.clear();
+        opened_files.clear();
         tree_roots.clear();
     }
 
@@ -89,30 +112,198 @@ XMLParser::~XMLParser()
     delete _p;
 }
 
-void XMLParser::loadFromFile(const std::string& filename)
+namespace
+{
+// Identifies a version of a file
+struct FileStamp
+{
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    int64_t size;
+
+    bool operator==(const FileStamp& other) const
+    {
+        return mtime_sec == other.mtime_sec && mtime_nsec == other.mtime_nsec &&
+               size == other.size;
+    }
+};
+
+// false if the file doesn't exist
+bool getFileStamp(const std::string& path, FileStamp& stamp)
+{
+#if defined(_WIN32)
+    struct _stat64 sb;
+    if( _stat64(path.c_str(), &sb) != 0 )
+    {
+        return false;
+    }
+    stamp.mtime_nsec = 0;
+#else
+    struct stat sb;
+    if( stat(path.c_str(), &sb) != 0 )
+    {
+        return false;
+    }
+#if defined(__APPLE__)
+    stamp.mtime_nsec = sb.st_mtimespec.tv_nsec;
+#else
+    stamp.mtime_nsec = sb.st_mtim.tv_nsec;
+#endif
+#endif
+    stamp.mtime_sec = sb.st_mtime;
+    stamp.size = sb.st_size;
+    return true;
+}
+
+struct CachedDocument
+{
+    std::shared_ptr<const BT_TinyXML2::XMLDocument> doc;
+    FileStamp stamp;
+};
+
+// TinyXML2 normalizes the names and the values lazily, in place, the first
+// time they are read: read all of them once, before the document is shared.
+void NormalizeStrings(const XMLNode* node)
+{
+    for (; node; node = node->NextSibling())
+    {
+        node->Value();
+        if( auto element = node->ToElement() )
+        {
+            for (auto attr = element->FirstAttribute(); attr; attr = attr->Next())
+            {
+                attr->Name();
+                attr->Value();
+            }
+        }
+        NormalizeStrings(node->FirstChild());
+    }
+}
+}
+
+struct XMLDocumentCache::Pimpl
+{
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, CachedDocument> documents;
+    size_t parsed_count = 0;
+
+    std::shared_ptr<const BT_TinyXML2::XMLDocument> load(const std::string& absolute_path)
+    {
+        FileStamp stamp;
+        const bool exists = getFileStamp(absolute_path, stamp);
+        if( exists )
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            auto it = documents.find(absolute_path);
+            if( it != documents.end() && it->second.stamp == stamp )
+            {
+                return it->second.doc;
+            }
+        }
+
+        // parse without holding the lock; the errors are not cached
+        auto doc = std::make_shared<BT_TinyXML2::XMLDocument>();
+        doc->LoadFile(absolute_path.c_str());
+        if( !doc->Error() )
+        {
+            NormalizeStrings(doc->FirstChild());
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        parsed_count++;
+        if( exists && !doc->Error() )
+        {
+            documents[absolute_path] = { doc, stamp };
+        }
+        return doc;
+    }
+};
+
+XMLDocumentCache::XMLDocumentCache():
+    _p( new Pimpl )
+{
+}
+
+XMLDocumentCache::~XMLDocumentCache()
+{
+    delete _p;
+}
+
+const std::shared_ptr<XMLDocumentCache>& XMLDocumentCache::global()
+{
+    static const std::shared_ptr<XMLDocumentCache> cache = std::make_shared<XMLDocumentCache>();
+    return cache;
+}
+
+size_t XMLDocumentCache::size() const
 {
-    _p->opened_documents.emplace_back(new BT_TinyXML2::XMLDocument());
+    std::unique_lock<std::mutex> lock(_p->mutex);
+    return _p->documents.size();
+}
 
-    BT_TinyXML2::XMLDocument* doc = _p->opened_documents.back().get();
-    doc->LoadFile(filename.c_str());
+size_t XMLDocumentCache::parsedCount() const
+{
+    std::unique_lock<std::mutex> lock(_p->mutex);
+    return _p->parsed_count;
+}
 
+void XMLDocumentCache::clear()
+{
+    std::unique_lock<std::mutex> lock(_p->mutex);
+    _p->documents.clear();
+}
+
+void XMLParser::loadFromFile(const std::string& filename)
+{
     filesystem::path file_path( filename );
     _p->current_path = file_path.parent_path().make_absolute();
 
-    _p->loadDocImpl( doc );
+    auto doc = _p->openFile( _p->current_path / file_path.filename() );
+    if( doc )
+    {
+        _p->loadDocImpl( doc.get() );
+    }
 }
 
 void XMLParser::loadFromText(const std::string& xml_text)
 {
-    _p->opened_documents.emplace_back(new BT_TinyXML2::XMLDocument());
-
-    BT_TinyXML2::XMLDocument* doc = _p->opened_documents.back().get();
+    auto doc = std::make_shared<BT_TinyXML2::XMLDocument>();
     doc->Parse(xml_text.c_str(), xml_text.size());
+    _p->opened_documents.push_back( doc );
+
+    _p->loadDocImpl( doc.get() );
+}
+
+std::shared_ptr<const BT_TinyXML2::XMLDocument>
+XMLParser::Pimpl::openFile(const filesystem::path& file_path)
+{
+    // the same file may be included by more than one document
+    std::string key = file_path.str();
+    if( file_path.exists() )
+    {
+        key = file_path.make_absolute().str();
+    }
+    if( !opened_files.insert(key).second )
+    {
+        return {};
+    }
 
-    _p->loadDocImpl( doc );
+    std::shared_ptr<const BT_TinyXML2::XMLDocument> doc;
+    if( const auto& cache = factory.xmlDocumentCache() )
+    {
+        doc = cache->_p->load(key);
+    }
+    else
+    {
+        auto new_doc = std::make_shared<BT_TinyXML2::XMLDocument>();
+        new_doc->LoadFile(key.c_str());
+        doc = std::move(new_doc);
+    }
+    opened_documents.push_back(doc);
+    return doc;
 }
 
-void XMLParser::Pimpl::loadDocImpl(BT_TinyXML2::XMLDocument* doc)
+void XMLParser::Pimpl::loadDocImpl(const BT_TinyXML2::XMLDocument* doc)
 {
     if (doc->Error())
     {
@@ -122,6 +313,10 @@ void XMLParser::Pimpl::loadDocImpl(BT_TinyXML2::XMLDocument* doc)
     }
 
     const XMLElement* xml_root = doc->RootElement();
+    if (!xml_root)
+    {
+        throw RuntimeError("The XML must have a root node called <root>");
+    }
 
     // recursively include other files
     for (auto include_node = xml_root->FirstChildElement("include");
@@ -154,10 +349,11 @@ void XMLParser::Pimpl::loadDocImpl(BT_TinyXML2::XMLDocument* doc)
             file_path = current_path / file_path;
         }
 
-        opened_documents.emplace_back(new BT_TinyXML2::XMLDocument());
-        BT_TinyXML2::XMLDocument* next_doc = opened_documents.back().get();
-        next_doc->LoadFile(file_path.str().c_str());
-        loadDocImpl(next_doc);
+        // a document included twice is loaded only the first time
+        if( auto next_doc = openFile(file_path) )
+        {
+            loadDocImpl(next_doc.get());
+        }
     }
 
     for (auto bt_node = xml_root->FirstChildElement("BehaviorTree");
@@ -175,11 +371,12 @@ void XMLParser::Pimpl::loadDocImpl(BT_TinyXML2::XMLDocument* doc)
         tree_roots.insert( {tree_name, bt_node} );
     }
 
-    std::set<std::string> registered_nodes;
-    XMLPrinter printer;
-    doc->Print(&printer);
-    auto xml_text = std::string(printer.CStr(), size_t(printer.CStrSize() - 1));
+    if( !factory.xmlVerificationEnabled() )
+    {
+        return;
+    }
 
+    std::set<std::string> registered_nodes;
     for( const auto& it: factory.manifests())
     {
         registered_nodes.insert( it.first );
@@ -189,7 +386,8 @@ void XMLParser::Pimpl::loadDocImpl(BT_TinyXML2::XMLDocument* doc)
         registered_nodes.insert( it.first );
     }
 
-    VerifyXML(xml_text, registered_nodes);
+    // the document was parsed already: verify the DOM directly
+    VerifyXMLDocument(*doc, registered_nodes);
 }
 
 void VerifyXML(const std::string& xml_text,
@@ -204,7 +402,14 @@ void VerifyXML(const std::string& xml_text,
         sprintf(buffer, "Error parsing the XML: %s", doc.ErrorName() );
         throw RuntimeError( buffer );
     }
+    VerifyXMLDocument(doc, registered_nodes);
+}
 
+namespace
+{
+void VerifyXMLDocument(const BT_TinyXML2::XMLDocument& doc,
+                       const std::set<std::string>& registered_nodes)
+{
     //-------- Helper functions (lambdas) -----------------
     auto StrEqual = [](const char* str1, const char* str2) -> bool {
         return strcmp(str1, str2) == 0;
@@ -399,12 +604,22 @@ void VerifyXML(const std::string& xml_text,
         }
     }
 }
+} // end anonymous namespace
 
 Tree XMLParser::instantiateTree(const Blackboard::Ptr& root_blackboard)
 {
-    Tree output_tree;
+    if( !root_blackboard )
+    {
+        throw RuntimeError("XMLParser::instantiateTree needs a non-empty root_blackboard");
+    }
+    return createBlueprint().instantiate(root_blackboard);
+}
 
-    XMLElement* xml_root = _p->opened_documents.front()->RootElement();
+TreeBlueprint XMLParser::createBlueprint()
+{
+    TreeBlueprint blueprint;
+
+    const XMLElement* xml_root = _p->opened_documents.front()->RootElement();
 
     std::string main_tree_ID;
     if (xml_root->Attribute("main_tree_to_execute"))
@@ -419,35 +634,51 @@ Tree XMLParser::instantiateTree(const Blackboard::Ptr& root_blackboard)
         throw RuntimeError("[main_tree_to_execute] was not specified correctly");
     }
     //--------------------------------------
-    if( !root_blackboard )
-    {
-        throw RuntimeError("XMLParser::instantiateTree needs a non-empty root_blackboard");
-    }
     // first blackboard
-    output_tree.blackboard_stack.push_back( root_blackboard );
+    blueprint.def_->blackboards.push_back( {0, {}} );
+    blueprint.use_node_arena_ = _p->factory.nodeArenaEnabled();
+    blueprint.instantiation_threads_ = _p->factory.instantiationThreads();
+    blueprint.lazy_subtrees_ = _p->factory.lazySubtreesEnabled();
+    blueprint.subtree_idle_time_ = _p->factory.subtreeIdleTime();
+    blueprint.def_->async_executor = _p->factory.asyncExecutor();
 
-    _p->recursivelyCreateTree(main_tree_ID,
-                              output_tree,
-                              root_blackboard,
-                              TreeNode::Ptr() );
+    _p->recursivelyCompileTree(main_tree_ID, blueprint, 0, -1);
+    blueprint.def_->computeSubtreeRanges();
+
+    return blueprint;
+}
 
-    if( output_tree.nodes.size() > 0)
+int XMLParser::Pimpl::builderIndex(const TreeNodeRegistration& registration,
+                                   TreeBlueprint& blueprint)
+{
+    const std::string& ID = registration.manifest.registration_ID;
+    for (size_t i = 0; i < blueprint.def_->builders.size(); i++)
     {
-        output_tree.root_node = output_tree.nodes.front().get();
+        if( blueprint.def_->builders[i].ID == ID )
+        {
+            return static_cast<int>(i);
+        }
     }
-    return output_tree;
+    TreeBlueprint::Builder builder;
+    builder.ID = ID;
+    builder.builder = registration.builder;
+    builder.arena_builder = registration.arena_builder;
+    blueprint.def_->builders.push_back( std::move(builder) );
+    return static_cast<int>(blueprint.def_->builders.size() - 1);
 }
 
-TreeNode::Ptr XMLParser::Pimpl::createNodeFromXML(const XMLElement *element,
-                                                  const Blackboard::Ptr &blackboard,
-                                                  const TreeNode::Ptr &node_parent)
+int XMLParser::Pimpl::compileNodeFromXML(const XMLElement *element,
+                                         size_t blackboard_index,
+                                         int parent_index,
+                                         TreeBlueprint& blueprint)
 {
-    const std::string element_name = element->Name();
+    const char* element_name = element->Name();
+    const bool is_subtree = strcmp(element_name, "SubTree") == 0;
     std::string ID;
-    std::string instance_name;
 
     // Actions and Decorators have their own ID
-    if (element_name == "Action" || element_name == "Decorator" || element_name == "Condition")
+    if (strcmp(element_name, "Action") == 0 || strcmp(element_name, "Decorator") == 0 ||
+        strcmp(element_name, "Condition") == 0)
     {
         ID = element->Attribute("ID");
     }
@@ -456,180 +687,125 @@ TreeNode::Ptr XMLParser::Pimpl::createNodeFromXML(const XMLElement *element,
         ID = element_name;
     }
 
-    const char* attr_alias = element->Attribute("name");
-    if (attr_alias)
+    TreeBlueprint::NodeRecord record;
+    if (is_subtree)
     {
-        instance_name = attr_alias;
+        record.instance_name = element->Attribute("ID");
     }
-    else
+    else if (const char* attr_alias = element->Attribute("name"))
     {
-        instance_name = ID;
+        record.instance_name = attr_alias;
     }
-
-    if (element_name == "SubTree")
+    else
     {
-        instance_name = element->Attribute("ID");
+        record.instance_name = ID;
     }
-
-    PortsRemapping remapping_parameters;
-
-    if (element_name != "SubTree") // in Subtree attributes have different meaning...
-    {
-        for (const XMLAttribute* att = element->FirstAttribute(); att; att = att->Next())
-        {
-            const std::string attribute_name = att->Name();
-            if (attribute_name != "ID" && attribute_name != "name")
-            {
-                remapping_parameters[attribute_name] = att->Value();
-            }
-        }
-    }
-    NodeConfiguration config;
-    config.blackboard = blackboard;
+    record.parent_index = parent_index;
+    record.blackboard_index = blackboard_index;
 
     //---------------------------------------------
-    TreeNode::Ptr child_node;
-
-    if( factory.builders().count(ID) != 0)
+    if( const TreeNodeRegistration* registration = factory.registration(ID) )
     {
-        const auto& manifest = factory.manifests().at(ID);
+        // in Subtree attributes have different meaning...
+        const XMLAttribute* first_attribute = is_subtree ? nullptr : element->FirstAttribute();
 
-        //Check that name in remapping can be found in the manifest
-        for(const auto& remapping_it: remapping_parameters)
+        for (const XMLAttribute* att = first_attribute; att; att = att->Next())
         {
-            if( manifest.ports.count( remapping_it.first ) == 0 )
+            const char* attribute_name = att->Name();
+            if (strcmp(attribute_name, "ID") == 0 || strcmp(attribute_name, "name") == 0)
+            {
+                continue;
+            }
+            //Check that name in remapping can be found in the manifest
+            const TreeNodeRegistration::Port* port = registration->findPort(attribute_name);
+            if( !port )
             {
                 throw RuntimeError("Possible typo? In the XML, you tried to remap port \"",
-                                   remapping_it.first, "\" in node [", ID," / ", instance_name,
+                                   attribute_name, "\" in node [", ID," / ", record.instance_name,
                                    "], but the manifest of this node does not contain a port with this name.");
             }
-        }
-
-        // Initialize the ports in the BB to set the type
-        for(const auto& port_it: manifest.ports)
-        {
-            const std::string& port_name = port_it.first;
-            const auto& port_info = port_it.second;
+            const char* remapping_value = att->Value();
 
-            auto remap_it = remapping_parameters.find(port_name);
-            if( remap_it == remapping_parameters.end())
-            {
-                continue;
-            }
-            StringView remapping_value = remap_it->second;
-            auto remapped_res = TreeNode::getRemappedKey(port_name, remapping_value);
+            // The ports in the BB will be initialized to set the type
+            auto remapped_res = TreeNode::getRemappedKey(port->name, remapping_value);
             if( remapped_res )
             {
-                const auto& port_key = nonstd::to_string(remapped_res.value());
-
-                auto prev_info = blackboard->portInfo( port_key );
-                if( !prev_info  )
-                {
-                    // not found, insert for the first time.
-                    blackboard->setPortInfo( port_key, port_info );
-                }
-                else{
-                    // found. check consistency
-                    if( prev_info->type() && port_info.type()  && // null type means that everything is valid
-                        prev_info->type()!= port_info.type())
-                    {
-                        blackboard->debugMessage();
-
-                        throw RuntimeError( "The creation of the tree failed because the port [", port_key,
-                                           "] was initially created with type [", demangle( prev_info->type() ),
-                                           "] and, later type [", demangle( port_info.type() ),
-                                           "] was used somewhere else." );
-                    }
-                }
+                record.port_declarations.push_back(
+                    { port->name, nonstd::to_string(remapped_res.value()), port->info } );
             }
-        }
 
-        // use manifest to initialize NodeConfiguration
-        for(const auto& remap_it: remapping_parameters)
-        {
-            const auto& port_name = remap_it.first;
-            auto port_it = manifest.ports.find( port_name );
-            if( port_it != manifest.ports.end() )
+            // use manifest to initialize NodeConfiguration
+            const auto direction = port->info.direction();
+            if( direction != PortDirection::OUTPUT )
             {
-                auto direction = port_it->second.direction();
-                if( direction != PortDirection::OUTPUT )
-                {
-                    config.input_ports.insert( remap_it );
-                }
-                if( direction != PortDirection::INPUT )
-                {
-                    config.output_ports.insert( remap_it );
-                }
+                record.input_ports.insert( {port->name, remapping_value} );
+            }
+            if( direction != PortDirection::INPUT )
+            {
+                record.output_ports.insert( {port->name, remapping_value} );
             }
         }
         // use default value if available for empty ports. Only inputs
-        for (const auto& port_it: manifest.ports)
+        for (const auto& port: registration->ports)
         {
-            const std::string& port_name =  port_it.first;
-            const PortInfo& port_info = port_it.second;
-
-            auto direction = port_info.direction();
-            if( direction != PortDirection::INPUT &&
-                config.input_ports.count(port_name) == 0 &&
-                port_info.defaultValue().empty() == false)
+            const PortInfo& port_info = port.info;
+            if( port_info.direction() != PortDirection::INPUT &&
+                port_info.defaultValue().empty() == false &&
+                record.input_ports.count(port.name) == 0 )
             {
-                config.input_ports.insert( { port_name, port_info.defaultValue() } );
+                record.input_ports.insert( { port.name, port_info.defaultValue() } );
             }
         }
-        child_node = factory.instantiateTreeNode(instance_name, ID, config);
+        TreeBlueprint::parseInputConstants(record, *registration);
+        record.builder_index = builderIndex(*registration, blueprint);
+        record.subtree = ( registration->manifest.type == NodeType::SUBTREE );
     }
     else if( tree_roots.count(ID) != 0) {
-        child_node = std::make_unique<DecoratorSubtreeNode>( instance_name );
+        record.builder_index = -1;
+        record.subtree = true;
     }
     else{
         throw RuntimeError( ID, " is not a registered node, nor a Subtree");
     }
 
-    if (node_parent)
-    {
-        if (auto control_parent = dynamic_cast<ControlNode*>(node_parent.get()))
-        {
-            control_parent->addChild(child_node.get());
-        }
-        if (auto decorator_parent = dynamic_cast<DecoratorNode*>(node_parent.get()))
-        {
-            decorator_parent->setChild(child_node.get());
-        }
-    }
-    return child_node;
+    blueprint.def_->nodes.push_back( std::move(record) );
+    return static_cast<int>(blueprint.def_->nodes.size() - 1);
 }
 
-void BT::XMLParser::Pimpl::recursivelyCreateTree(const std::string& tree_ID,
-                                                 Tree& output_tree,
-                                                 Blackboard::Ptr blackboard,
-                                                 const TreeNode::Ptr& root_parent)
+void BT::XMLParser::Pimpl::recursivelyCompileTree(const std::string& tree_ID,
+                                                  TreeBlueprint& blueprint,
+                                                  size_t blackboard_index,
+                                                  int root_parent_index)
 {
-    std::function<void(const TreeNode::Ptr&, const XMLElement*)> recursiveStep;
+    std::function<void(int, const XMLElement*)> recursiveStep;
 
-    recursiveStep = [&](const TreeNode::Ptr& parent,
+    recursiveStep = [&](int parent_index,
                         const XMLElement* element)
     {
-        auto node = createNodeFromXML(element, blackboard, parent);
-        output_tree.nodes.push_back(node);
+        int node_index = compileNodeFromXML(element, blackboard_index, parent_index, blueprint);
 
-        if( node->type() == NodeType::SUBTREE )
+        if( blueprint.def_->nodes[node_index].subtree )
         {
-            auto new_bb = Blackboard::create(blackboard);
-
+            // the Blackboard is created together with the SubTree node.
+            TreeBlueprint::BlackboardRecord bb_record;
+            bb_record.parent_index = blackboard_index;
             for (const XMLAttribute* attr = element->FirstAttribute(); attr != nullptr; attr = attr->Next())
             {
-                new_bb->addSubtreeRemapping( attr->Name(), attr->Value() );
+                bb_record.remappings.emplace_back( attr->Name(), attr->Value() );
             }
+            blueprint.def_->blackboards.push_back( std::move(bb_record) );
 
-            output_tree.blackboard_stack.emplace_back(new_bb);
-            recursivelyCreateTree( node->name(), output_tree, new_bb, node );
+            // copy: the vector of nodes will grow
+            const std::string subtree_ID = blueprint.def_->nodes[node_index].instance_name;
+            recursivelyCompileTree( subtree_ID, blueprint,
+                                    blueprint.def_->blackboards.size() - 1, node_index );
         }
         else
         {
             for (auto child_element = element->FirstChildElement(); child_element;
                  child_element = child_element->NextSiblingElement())
             {
-                recursiveStep(node, child_element);
+                recursiveStep(node_index, child_element);
             }
         }
     };
@@ -637,9 +813,60 @@ void BT::XMLParser::Pimpl::recursivelyCreateTree(const std::string& tree_ID,
     auto root_element = tree_roots[tree_ID]->FirstChildElement();
 
     // start recursion
-    recursiveStep(root_parent, root_element);
+    recursiveStep(root_parent_index, root_element);
+}
+
+
+namespace
+{
+// Append to model_root the element that describes the node and its ports
+void writeNodeModel(BT_TinyXML2::XMLDocument& doc, XMLElement* model_root,
+                    const TreeNodeManifest& model)
+{
+    XMLElement* element = doc.NewElement( toStr(model.type).c_str() );
+    element->SetAttribute("ID", model.registration_ID.c_str());
+
+    for (auto& port : model.ports)
+    {
+        const auto& port_name = port.first;
+        const auto& port_info = port.second;
+
+        XMLElement* port_element = nullptr;
+        switch(  port_info.direction() )
+        {
+        case PortDirection::INPUT:  port_element = doc.NewElement("input_port");  break;
+        case PortDirection::OUTPUT: port_element = doc.NewElement("output_port"); break;
+        case PortDirection::INOUT:  port_element = doc.NewElement("inout_port");  break;
+        }
+
+        port_element->SetAttribute("name", port_name.c_str() );
+        if( port_info.type() )
+        {
+            port_element->SetAttribute("type", BT::demangle( port_info.type() ).c_str() );
+        }
+        if( !port_info.defaultValue().empty() )
+        {
+            port_element->SetAttribute("default", port_info.defaultValue().c_str() );
+        }
+
+        if( !port_info.description().empty() )
+        {
+            port_element->SetText( port_info.description().c_str() );
+        }
+
+        element->InsertEndChild(port_element);
+    }
+
+    model_root->InsertEndChild(element);
 }
 
+std::string printDocument(const BT_TinyXML2::XMLDocument& doc)
+{
+    XMLPrinter printer;
+    doc.Print(&printer);
+    return std::string(printer.CStr(), size_t(printer.CStrSize() - 1));
+}
+}
 
 std::string writeTreeNodesModelXML(const BehaviorTreeFactory& factory)
 {
@@ -667,46 +894,107 @@ std::string writeTreeNodesModelXML(const BehaviorTreeFactory& factory)
         {
             continue;
         }
-        XMLElement* element = doc.NewElement( toStr(model.type).c_str() );
-        element->SetAttribute("ID", model.registration_ID.c_str());
+        writeNodeModel(doc, model_root, model);
+    }
+
+    return printDocument(doc);
+}
+
+std::string writePluginManifestXML(const BehaviorTreeFactory& factory,
+                                   const std::string& plugin_path)
+{
+    BT_TinyXML2::XMLDocument doc;
+
+    XMLElement* rootXML = doc.NewElement("root");
+    doc.InsertFirstChild(rootXML);
+
+    XMLElement* model_root = doc.NewElement("TreeNodesModel");
+    model_root->SetAttribute("plugin", plugin_path.c_str());
+    rootXML->InsertEndChild(model_root);
+
+    // sorted, to write the same file every time
+    std::map<std::string, const TreeNodeManifest*> models;
+    for (auto& model_it : factory.manifests())
+    {
+        if( factory.builtinNodes().count( model_it.first ) == 0)
+        {
+            models.insert( {model_it.first, &model_it.second} );
+        }
+    }
+    for (auto& model_it : models)
+    {
+        writeNodeModel(doc, model_root, *model_it.second);
+    }
+
+    return printDocument(doc);
+}
+
+PluginManifest readPluginManifestXML(const std::string& xml_text)
+{
+    BT_TinyXML2::XMLDocument doc;
+    if( doc.Parse( xml_text.c_str(), xml_text.size() ) )
+    {
+        char buffer[200];
+        sprintf(buffer, "Error parsing the plugin manifest: %s", doc.ErrorName() );
+        throw RuntimeError( buffer );
+    }
+
+    const XMLElement* xml_root = doc.RootElement();
+    const XMLElement* model_root = xml_root ? xml_root->FirstChildElement("TreeNodesModel") : nullptr;
+    if( !model_root || !model_root->Attribute("plugin") )
+    {
+        throw RuntimeError("The plugin manifest must contain <TreeNodesModel plugin=\"...\">");
+    }
 
-        for (auto& port : model.ports)
+    PluginManifest manifest;
+    manifest.plugin_path = model_root->Attribute("plugin");
+
+    for (auto element = model_root->FirstChildElement(); element != nullptr;
+         element = element->NextSiblingElement())
+    {
+        TreeNodeManifest node_manifest;
+        node_manifest.type = convertFromString<NodeType>( element->Name() );
+        if( node_manifest.type == NodeType::UNDEFINED || !element->Attribute("ID") )
         {
-            const auto& port_name = port.first;
-            const auto& port_info = port.second;
+            throw RuntimeError("Error at line ", std::to_string( element->GetLineNum() ),
+                               " of the plugin manifest: unknown node type or missing [ID]");
+        }
+        node_manifest.registration_ID = element->Attribute("ID");
 
-            XMLElement* port_element = nullptr;
-            switch(  port_info.direction() )
+        for (auto port_element = element->FirstChildElement(); port_element != nullptr;
+             port_element = port_element->NextSiblingElement())
+        {
+            const char* port_kind = port_element->Name();
+            PortDirection direction = PortDirection::INOUT;
+            if( strcmp(port_kind, "input_port") == 0 )
             {
-            case PortDirection::INPUT:  port_element = doc.NewElement("input_port");  break;
-            case PortDirection::OUTPUT: port_element = doc.NewElement("output_port"); break;
-            case PortDirection::INOUT:  port_element = doc.NewElement("inout_port");  break;
+                direction = PortDirection::INPUT;
             }
-
-            port_element->SetAttribute("name", port_name.c_str() );
-            if( port_info.type() )
+            else if( strcmp(port_kind, "output_port") == 0 )
             {
-                port_element->SetAttribute("type", BT::demangle( port_info.type() ).c_str() );
+                direction = PortDirection::OUTPUT;
             }
-            if( !port_info.defaultValue().empty() )
+            const char* port_name = port_element->Attribute("name");
+            if( !port_name )
             {
-                port_element->SetAttribute("default", port_info.defaultValue().c_str() );
+                throw RuntimeError("Error at line ", std::to_string( port_element->GetLineNum() ),
+                                   " of the plugin manifest: missing [name] of the port");
             }
-
-            if( !port_info.description().empty() )
+            // the type is only a name: the port can't be type-checked
+            PortInfo port_info( direction );
+            if( const char* default_value = port_element->Attribute("default") )
             {
-                port_element->SetText( port_info.description().c_str() );
+                port_info.setDefaultValue( default_value );
             }
-
-            element->InsertEndChild(port_element);
+            if( const char* description = port_element->GetText() )
+            {
+                port_info.setDescription( description );
+            }
+            node_manifest.ports.insert( {port_name, std::move(port_info)} );
         }
-
-        model_root->InsertEndChild(element);
+        manifest.nodes.push_back( std::move(node_manifest) );
     }
-
-    XMLPrinter printer;
-    doc.Print(&printer);
-    return std::string(printer.CStr(), size_t(printer.CStrSize() - 1));
+    return manifest;
 }
 
 Tree buildTreeFromText(const BehaviorTreeFactory& factory, const std::string& text,
@@ -11,6 +11,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include "action_test_node.h"
 #include "condition_test_node.h"
 #include "behaviortree_cpp_v3/behavior_tree.h"
@@ -297,3 +298,468 @@ TEST(BlackboardTest, CheckTypeSafety)
     ASSERT_TRUE( is );
 }
 
+
+class BB_HandleTestNode: public SyncActionNode
+{
+  public:
+    BB_HandleTestNode(const std::string& name, const NodeConfiguration& config):
+      SyncActionNode(name, config),
+      in_port_( getInputHandle<int>("in_port") ),
+      out_port_( getOutputHandle<int>("out_port") )
+    { }
+
+    NodeStatus tick()
+    {
+        auto res = in_port_.get();
+        if(!res)
+        {
+            throw RuntimeError("BB_HandleTestNode needs input", res.error());
+        }
+        if( !out_port_.set( res.value()*2 ) )
+        {
+            throw RuntimeError("BB_HandleTestNode failed output");
+        }
+        return NodeStatus::SUCCESS;
+    }
+
+    static PortsList providedPorts()
+    {
+        return { BT::InputPort<int>("in_port"),
+                 BT::OutputPort<int>("out_port") };
+    }
+
+  private:
+    PortHandle<int> in_port_;
+    PortHandle<int> out_port_;
+};
+
+TEST(BlackboardTest, PortHandles)
+{
+    auto bb = Blackboard::create();
+
+    NodeConfiguration config;
+    config.blackboard = bb;
+    config.input_ports["in_port"]   = "{my_input_port}";
+    config.output_ports["out_port"] = "{my_output_port}";
+    bb->setPortInfo("my_output_port", BT::OutputPort<int>("out_port").second);
+
+    // the entries are created after the resolution of the handles
+    BB_HandleTestNode node("handles", config);
+    ASSERT_THROW( node.executeTick(), RuntimeError );
+
+    bb->set("my_input_port", 11 );
+    node.executeTick();
+    ASSERT_EQ( bb->get<int>("my_output_port"), 22 );
+
+    // both handles now point at the entries
+    bb->set("my_input_port", 5 );
+    node.executeTick();
+    ASSERT_EQ( bb->get<int>("my_output_port"), 10 );
+
+    // once declared, the type can not change
+    auto double_handle = node.getOutputHandle<double>("out_port");
+    ASSERT_THROW( double_handle.set(3.5), LogicError );
+
+    auto missing = node.getInputHandle<int>("not_a_port");
+    ASSERT_FALSE( missing.get() );
+
+    config.input_ports["in_port"] = "7";
+    BB_HandleTestNode literal_node("literal", config);
+    ASSERT_TRUE( literal_node.getInputHandle<int>("in_port").isConstant() );
+    literal_node.executeTick();
+    ASSERT_EQ( bb->get<int>("my_output_port"), 14 );
+
+    config.input_ports["in_port"] = "seven";
+    BB_HandleTestNode invalid_node("invalid", config);
+    ASSERT_FALSE( invalid_node.getInputHandle<int>("in_port").get() );
+}
+
+TEST(BlackboardTest, PortHandlesInSubtree)
+{
+    auto parent_bb = Blackboard::create();
+    auto bb = Blackboard::create(parent_bb);
+    bb->addSubtreeRemapping("in_port", "parent_input");
+    bb->addSubtreeRemapping("out_port", "parent_output");
+
+    NodeConfiguration config;
+    assignDefaultRemapping<BB_HandleTestNode>( config );
+    config.blackboard = bb;
+
+    BB_HandleTestNode node("handles", config);
+    parent_bb->set("parent_input", 21 );
+    node.executeTick();
+    ASSERT_EQ( parent_bb->get<int>("parent_output"), 42 );
+
+    parent_bb->set("parent_input", 1 );
+    node.executeTick();
+    ASSERT_EQ( parent_bb->get<int>("parent_output"), 2 );
+    ASSERT_EQ( bb->get<int>("out_port"), 2 );
+}
+
+TEST(BlackboardTest, ConcurrentAccess)
+{
+    auto bb = Blackboard::create();
+    const std::string text_a(1000, 'a');
+    const std::string text_b(1000, 'b');
+    bb->set("text", text_a);
+    bb->set("counter", 0);
+
+    std::atomic<bool> inconsistent(false);
+    auto writer = [&](const std::string& text)
+    {
+        for(int i=0; i<2000; i++)
+        {
+            bb->set("text", text);
+            bb->set("counter", i);
+        }
+    };
+    auto reader = [&]()
+    {
+        for(int i=0; i<2000; i++)
+        {
+            auto text = bb->get<std::string>("text");
+            if( text != text_a && text != text_b )
+            {
+                inconsistent = true;
+            }
+            bb->get<int>("counter");
+        }
+    };
+
+    std::thread writer_a(writer, text_a);
+    std::thread writer_b(writer, text_b);
+    std::thread reader_thread(reader);
+    writer_a.join();
+    writer_b.join();
+    reader_thread.join();
+
+    ASSERT_FALSE( inconsistent );
+    ASSERT_EQ( bb->get<int>("counter"), 1999 );
+}
+
+TEST(BlackboardTest, ManyKeysAndRemapping)
+{
+    auto parent_bb = Blackboard::create();
+    auto bb = Blackboard::create(parent_bb);
+
+    const int count = 1000;
+    for(int i=0; i<count; i++)
+    {
+        if( i % 2 == 0 )
+        {
+            bb->addSubtreeRemapping( "key_" + std::to_string(i), "parent_key_" + std::to_string(i) );
+        }
+        bb->set( "key_" + std::to_string(i), i );
+    }
+    for(int i=0; i<count; i++)
+    {
+        ASSERT_EQ( bb->get<int>("key_" + std::to_string(i)), i );
+        if( i % 2 == 0 )
+        {
+            ASSERT_EQ( parent_bb->get<int>("parent_key_" + std::to_string(i)), i );
+            ASSERT_FALSE( parent_bb->getAny("key_" + std::to_string(i)) );
+        }
+        else{
+            ASSERT_FALSE( parent_bb->getAny("key_" + std::to_string(i)) );
+        }
+    }
+    ASSERT_FALSE( bb->getAny("not_a_key") );
+    ASSERT_THROW( bb->get<int>("not_a_key"), RuntimeError );
+}
+
+TEST(BlackboardTest, RemappingChain)
+{
+    // root <- level_1 <- ... <- level_5, each one remapping [value]
+    // to [value] of the parent, but the root, where it is called [root_value]
+    std::vector<Blackboard::Ptr> stack = { Blackboard::create() };
+    for(int i=1; i<=5; i++)
+    {
+        auto bb = Blackboard::create( stack.back() );
+        bb->addSubtreeRemapping( "value", i == 1 ? "root_value" : "value" );
+        stack.push_back(bb);
+    }
+    stack.front()->setPortInfo( "root_value", BT::InputPort<int>("value").second );
+
+    stack.back()->set("value", 42);
+    ASSERT_EQ( stack.front()->get<int>("root_value"), 42 );
+    ASSERT_FALSE( stack.front()->getAny("value") );
+
+    // the placeholders of the intermediate levels are created too
+    for(size_t i=1; i<stack.size(); i++)
+    {
+        ASSERT_EQ( stack[i]->portInfo("value")->type(), &typeid(int) );
+        ASSERT_EQ( stack[i]->get<int>("value"), 42 );
+    }
+
+    stack.front()->set("root_value", 7);
+    ASSERT_EQ( stack.back()->get<int>("value"), 7 );
+    stack[2]->set("value", 8);
+    ASSERT_EQ( stack.back()->get<int>("value"), 8 );
+    ASSERT_EQ( stack.back()->getEntry("value"), stack.front()->getEntry("root_value") );
+
+    // the chains are flattened: a key used already can't be remapped later
+    auto root = Blackboard::create();
+    auto parent = Blackboard::create( root );
+    auto child = Blackboard::create( parent );
+    child->addSubtreeRemapping( "value", "parent_value" );
+    EXPECT_THROW( parent->addSubtreeRemapping( "parent_value", "root_value" ), LogicError );
+    parent->set( "other_value", 1 );
+    EXPECT_THROW( parent->addSubtreeRemapping( "other_value", "root_value" ), LogicError );
+
+    // the remappings don't keep the ancestors alive
+    std::weak_ptr<Blackboard> weak_root = stack.front();
+    auto leaf = stack.back();
+    stack.clear();
+    ASSERT_TRUE( weak_root.expired() );
+    ASSERT_FALSE( leaf->getEntry("value") == nullptr );
+}
+
+enum class TestColor { RED, GREEN };
+
+TEST(BlackboardTest, AnyCasting)
+{
+    ASSERT_TRUE( Any().empty() );
+    ASSERT_THROW( Any().cast<int>(), std::runtime_error );
+
+    Any integer(42);
+    ASSERT_TRUE( integer.isNumber() );
+    ASSERT_EQ( integer.type(), typeid(int) );
+    ASSERT_EQ( integer.castedType(), typeid(int64_t) );
+    ASSERT_EQ( integer.cast<int>(), 42 );
+    ASSERT_EQ( integer.cast<uint8_t>(), 42 );
+    ASSERT_EQ( integer.cast<double>(), 42.0 );
+    ASSERT_EQ( integer.cast<std::string>(), "42" );
+    ASSERT_TRUE( integer.cast<bool>() );
+    ASSERT_THROW( Any(300).cast<uint8_t>(), std::runtime_error );
+    ASSERT_THROW( Any(-1).cast<unsigned>(), std::runtime_error );
+
+    Any real(3.5);
+    ASSERT_EQ( real.castedType(), typeid(double) );
+    ASSERT_EQ( real.cast<double>(), 3.5 );
+    ASSERT_EQ( Any(2.0).cast<int>(), 2 );
+    ASSERT_THROW( real.cast<int>(), std::runtime_error );
+    ASSERT_EQ( Any(1.5f).cast<float>(), 1.5f );
+
+    ASSERT_EQ( Any(uint64_t(7)).cast<int>(), 7 );
+    ASSERT_EQ( Any(TestColor::GREEN).cast<TestColor>(), TestColor::GREEN );
+    ASSERT_EQ( Any(1).cast<TestColor>(), TestColor::GREEN );
+    ASSERT_THROW( real.cast<TestColor>(), std::runtime_error );
+
+    Any text(std::string("hello"));
+    ASSERT_TRUE( text.isString() );
+    ASSERT_FALSE( text.isNumber() );
+    ASSERT_EQ( text.cast<std::string>(), "hello" );
+    ASSERT_THROW( text.cast<int>(), std::runtime_error );
+
+    Any vect( std::vector<int>{1, 2, 3} );
+    ASSERT_EQ( vect.castedType(), typeid(std::vector<int>) );
+    ASSERT_EQ( vect.cast<std::vector<int>>().size(), 3 );
+    ASSERT_THROW( vect.cast<std::vector<double>>(), std::runtime_error );
+    ASSERT_THROW( vect.cast<std::string>(), std::runtime_error );
+
+    Any copy = text;
+    copy = integer;
+    ASSERT_EQ( copy.cast<int>(), 42 );
+    copy = Any(vect);
+    ASSERT_EQ( copy.cast<std::vector<int>>()[2], 3 );
+
+    // a moved-from Any is empty
+    Any moved( std::move(copy) );
+    ASSERT_TRUE( copy.empty() );
+    ASSERT_THROW( copy.cast<std::vector<int>>(), std::runtime_error );
+    copy = std::move(moved);
+    ASSERT_TRUE( moved.empty() );
+    ASSERT_EQ( copy.cast<std::vector<int>>()[2], 3 );
+}
+
+struct CopyCounter
+{
+    CopyCounter(int* counter_ptr): counter(counter_ptr), data(1000, 1.0) {}
+    CopyCounter(const CopyCounter& other): counter(other.counter), data(other.data)
+    {
+        (*counter)++;
+    }
+    CopyCounter(CopyCounter&& other) = default;
+    CopyCounter& operator=(const CopyCounter& other)
+    {
+        counter = other.counter;
+        data = other.data;
+        (*counter)++;
+        return *this;
+    }
+    CopyCounter& operator=(CopyCounter&& other) = default;
+
+    int* counter;
+    std::vector<double> data;
+};
+
+class BB_BorrowTestNode: public SyncActionNode
+{
+  public:
+    BB_BorrowTestNode(const std::string& name, const NodeConfiguration& config):
+      SyncActionNode(name, config)
+    { }
+
+    NodeStatus tick()
+    {
+        LockedConstRef<CopyCounter> input;
+        if( !getInput("in_port", input) )
+        {
+            throw RuntimeError("BB_BorrowTestNode needs input");
+        }
+        CopyCounter output(input->counter);
+        output.data.push_back( input->data.size() );
+        if( !setOutput("out_port", std::move(output)) )
+        {
+            throw RuntimeError("BB_BorrowTestNode failed output");
+        }
+        return NodeStatus::SUCCESS;
+    }
+
+    static PortsList providedPorts()
+    {
+        return { BT::InputPort<CopyCounter>("in_port"),
+                 BT::OutputPort<CopyCounter>("out_port") };
+    }
+};
+
+TEST(BlackboardTest, MoveAndBorrow)
+{
+    auto bb = Blackboard::create();
+    int copies = 0;
+
+    bb->set("value", CopyCounter(&copies));
+    bb->emplace<CopyCounter>("emplaced", &copies);
+    ASSERT_EQ( copies, 0 );
+
+    {
+        auto ref = bb->borrow<CopyCounter>("value");
+        ASSERT_EQ( ref->data.size(), 1000 );
+        ASSERT_EQ( ref.get(), bb->getAny("value")->castPtr<CopyCounter>() );
+    }
+    ASSERT_EQ( copies, 0 );
+    ASSERT_THROW( bb->borrow<CopyCounter>("missing"), RuntimeError );
+    ASSERT_THROW( bb->borrow<int>("value"), RuntimeError );
+
+    // the lock is released when the reference is destroyed
+    bb->set("value", CopyCounter(&copies));
+    ASSERT_EQ( copies, 0 );
+
+    NodeConfiguration config;
+    assignDefaultRemapping<BB_BorrowTestNode>( config );
+    config.blackboard = bb;
+    config.input_ports["in_port"] = "{value}";
+
+    BB_BorrowTestNode node("borrow", config);
+    node.executeTick();
+    ASSERT_EQ( copies, 0 );
+    ASSERT_EQ( bb->borrow<CopyCounter>("out_port")->data.size(), 1001 );
+
+    // an entry that is not a CopyCounter
+    bb->set("value", 42);
+    ASSERT_THROW( node.executeTick(), RuntimeError );
+
+    config.input_ports["in_port"] = "literal";
+    BB_BorrowTestNode literal_node("literal", config);
+    ASSERT_THROW( literal_node.executeTick(), RuntimeError );
+}
+
+TEST(BlackboardTest, InputConstants)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<BB_TestNode>("BB_TestNode");
+
+    const std::string xml_text = R"(
+    <root main_tree_to_execute = "MainTree" >
+        <BehaviorTree ID="MainTree">
+            <Repeat num_cycles="3">
+                <Sequence>
+                    <BB_TestNode name="literal" in_port="21" out_port="{out}"/>
+                    <BB_TestNode name="remapped" in_port="{out}" out_port="{twice}"/>
+                </Sequence>
+            </Repeat>
+        </BehaviorTree>
+    </root>)";
+
+    auto tree = factory.createTreeFromText(xml_text);
+    const TreeNode* repeat = tree.root_node;
+    const TreeNode* literal = tree.nodes[2].get();
+    const TreeNode* remapped = tree.nodes[3].get();
+
+    // the literals are converted once, with the type declared by the port
+    const auto& constants = repeat->config().input_constants;
+    ASSERT_EQ( constants.count("num_cycles"), 1 );
+    ASSERT_EQ( constants.at("num_cycles").type(), typeid(int) );
+    ASSERT_EQ( literal->config().input_constants.at("in_port").cast<int>(), 21 );
+    ASSERT_TRUE( remapped->config().input_constants.empty() );
+
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_EQ( tree.rootBlackboard()->get<int>("out"), 42 );
+    ASSERT_EQ( tree.rootBlackboard()->get<int>("twice"), 84 );
+
+    // a different type is still converted from the text
+    ASSERT_EQ( literal->getInput<double>("in_port").value(), 21.0 );
+    ASSERT_EQ( literal->getInput<std::string>("in_port").value(), "21" );
+    ASSERT_TRUE( literal->getInputHandle<int>("in_port").isConstant() );
+    ASSERT_EQ( literal->getInputHandle<int>("in_port").get().value(), 21 );
+
+    // a literal that can't be converted fails in getInput(), as before
+    const std::string invalid_text = R"(
+    <root main_tree_to_execute = "MainTree" >
+        <BehaviorTree ID="MainTree">
+            <BB_TestNode in_port="twenty" out_port="{out}"/>
+        </BehaviorTree>
+    </root>)";
+    auto invalid_tree = factory.createTreeFromText(invalid_text);
+    ASSERT_TRUE( invalid_tree.root_node->config().input_constants.empty() );
+    ASSERT_THROW( invalid_tree.root_node->executeTick(), RuntimeError );
+}
+
+TEST(BasicTypes, ConvertNumbers)
+{
+    ASSERT_EQ( convertFromString<int>("42"), 42 );
+    ASSERT_EQ( convertFromString<int>(" -17 "), -17 );
+    ASSERT_EQ( convertFromString<int>("-2147483648"), std::numeric_limits<int>::min() );
+    ASSERT_EQ( convertFromString<unsigned>("4294967295"), std::numeric_limits<unsigned>::max() );
+    ASSERT_THROW( convertFromString<int>("2147483648"), RuntimeError );
+    ASSERT_THROW( convertFromString<unsigned>("-1"), RuntimeError );
+    ASSERT_THROW( convertFromString<int>("3.5"), RuntimeError );
+    ASSERT_THROW( convertFromString<int>(""), RuntimeError );
+
+    // the view is not read past its end
+    const char* text = "12;34";
+    ASSERT_EQ( convertFromString<int>( StringView(text, 1) ), 1 );
+    ASSERT_EQ( convertFromString<double>( StringView(text, 2) ), 12.0 );
+
+    ASSERT_EQ( convertFromString<double>("3.14"), 3.14 );
+    ASSERT_EQ( convertFromString<double>("-.5e-3"), -0.0005 );
+    ASSERT_EQ( convertFromString<double>("1e300"), 1e300 );
+    ASSERT_EQ( convertFromString<double>("0.12345678901234567890123"), 0.12345678901234567890123 );
+    ASSERT_TRUE( std::isinf( convertFromString<double>("inf") ) );
+    ASSERT_THROW( convertFromString<double>("1.5m"), RuntimeError );
+    ASSERT_THROW( convertFromString<double>("e5"), RuntimeError );
+
+    // same result of strtod, in the fast path and in the slow one
+    char buffer[64];
+    for(int i = 0; i < 10000; i++)
+    {
+        const double value = (i % 2 ? -1.0 : 1.0) * (i * 7919 % 100003) / (1 + i % 997);
+        for(const char* format: {"%.17g", "%.6f", "%.3e"})
+        {
+            snprintf(buffer, sizeof(buffer), format, value);
+            ASSERT_EQ( convertFromString<double>(buffer), std::strtod(buffer, nullptr) ) << buffer;
+        }
+    }
+
+    auto ints = convertFromString<std::vector<int>>("1;-2; 3;");
+    ASSERT_EQ( ints, std::vector<int>({1, -2, 3}) );
+    auto reals = convertFromString<std::vector<double>>("0.5;1e3;-2");
+    ASSERT_EQ( reals, std::vector<double>({0.5, 1000.0, -2.0}) );
+    ASSERT_TRUE( convertFromString<std::vector<double>>("").empty() );
+    ASSERT_THROW( convertFromString<std::vector<int>>("1;;2"), RuntimeError );
+
+    auto parts = splitString("a;bb;;c", ';');
+    ASSERT_EQ( parts.size(), 4 );
+    ASSERT_EQ( parts[1], "bb" );
+    ASSERT_EQ( parts[2], "" );
+}
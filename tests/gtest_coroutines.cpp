@@ -1,6 +1,9 @@
 #include "behaviortree_cpp_v3/decorators/timeout_node.h"
 #include "behaviortree_cpp_v3/behavior_tree.h"
+#include "behaviortree_cpp_v3/bt_factory.h"
+#include "behaviortree_cpp_v3/utils/coroutine_stack_pool.h"
 #include <chrono>
+#include <cstring>
 #include <gtest/gtest.h>
 
 using namespace std::chrono;
@@ -13,8 +16,9 @@ class SimpleCoroAction : public BT::CoroActionNode
   public:
     SimpleCoroAction(milliseconds timeout, bool will_fail,
                      const std::string &node_name,
-                     const BT::NodeConfiguration &config)
-      : BT::CoroActionNode(node_name, config)
+                     const BT::NodeConfiguration &config,
+                     size_t stack_size = BT::CoroutineStackPool::DEFAULT_STACK_SIZE)
+      : BT::CoroActionNode(node_name, config, stack_size)
       , will_fail_(will_fail)
       , timeout_(timeout)
       , start_time_(Timepoint::min())
@@ -149,3 +153,147 @@ TEST(CoroTest, sequence_child)
 
 }
 
+
+#ifndef _WIN32
+TEST(CoroTest, stack_pool)
+{
+    BT::CoroutineStackPool pool(100000);
+    ASSERT_GE( pool.stackSize(), 100000 );
+
+    auto stack = pool.acquire();
+    ASSERT_EQ( stack.size, pool.stackSize() );
+    // the stack grows downwards
+    std::memset( stack.data + stack.size - 40000, 1, 40000 );
+    pool.release( stack );
+
+    auto reused = pool.acquire();
+    ASSERT_EQ( reused.data, stack.data );
+    ASSERT_EQ( pool.stacksCount(), 1 );
+    ASSERT_GE( pool.highWaterMark(), 40000 );
+    ASSERT_LT( pool.highWaterMark(), pool.stackSize() );
+
+    // overflow
+    ASSERT_DEATH( { volatile char* below = reused.data - 1; *below = 1; }, "" );
+
+    pool.release( reused );
+    pool.shrink();
+    ASSERT_EQ( pool.stacksCount(), 0 );
+    ASSERT_GE( pool.highWaterMark(), 40000 );
+}
+#endif
+
+TEST(CoroTest, stack_size_per_node_type)
+{
+    BT::BehaviorTreeFactory factory;
+    factory.registerBuilder<SimpleCoroAction>("SmallStackCoro",
+        [](const std::string& name, const BT::NodeConfiguration& config)
+    {
+        return std::make_unique<SimpleCoroAction>( milliseconds(5), false, name, config, 64 * 1024 );
+    });
+    auto tree = factory.createTreeFromText(R"(
+        <root><BehaviorTree><Sequence>
+            <SmallStackCoro/><SmallStackCoro/>
+        </Sequence></BehaviorTree></root>)");
+    EXPECT_EQ( BT::NodeStatus::SUCCESS, executeWhileRunning(*tree.root_node) );
+    EXPECT_EQ( BT::NodeStatus::SUCCESS, executeWhileRunning(*tree.root_node) );
+
+    auto reports = BT::CoroutineStackPool::reportNodeTypes();
+    auto it = std::find_if( reports.begin(), reports.end(),
+                            [](const BT::CoroutineStackPool::Report& r)
+                            { return r.node_type == "SmallStackCoro"; } );
+    ASSERT_NE( it, reports.end() );
+    EXPECT_EQ( it->stack_size, 64 * 1024 );
+    // the second action reuses the stack of the first one
+    EXPECT_EQ( it->stacks_count, 1 );
+#ifndef _WIN32
+    EXPECT_GT( it->high_water_mark, 0 );
+#endif
+    EXPECT_LE( it->high_water_mark, 64 * 1024 );
+}
+
+#ifdef BT_CPP20_COROUTINES
+class StacklessAction : public BT::StacklessCoroActionNode
+{
+  public:
+    StacklessAction(const std::string& name, const BT::NodeConfiguration& config)
+      : BT::StacklessCoroActionNode(name, config)
+    {
+    }
+
+    ~StacklessAction() override
+    {
+        // the frame updates destroyed_frames
+        halt();
+    }
+
+    static BT::PortsList providedPorts()
+    {
+        return {};
+    }
+
+    int steps = 0;
+    bool ready = true;
+    int destroyed_frames = 0;
+
+  protected:
+    Task coroTick() override
+    {
+        // destroyed with the frame, also when halted
+        auto counter = std::shared_ptr<int>( &destroyed_frames, [](int* count) { (*count)++; } );
+        steps++;
+        co_await yield();
+        steps++;
+        co_await waitUntil([this]() { return ready; });
+        steps++;
+        co_return BT::NodeStatus::SUCCESS;
+    }
+};
+
+TEST(CoroTest, stackless_action)
+{
+    BT::NodeConfiguration config;
+    StacklessAction action("action", config);
+    action.ready = false;
+
+    EXPECT_EQ( action.executeTick(), BT::NodeStatus::RUNNING );
+    EXPECT_EQ( action.steps, 1 );
+    EXPECT_EQ( action.executeTick(), BT::NodeStatus::RUNNING );
+    EXPECT_EQ( action.steps, 2 );
+    // the coroutine is not resumed until the predicate is true
+    EXPECT_EQ( action.executeTick(), BT::NodeStatus::RUNNING );
+    EXPECT_EQ( action.steps, 2 );
+    action.ready = true;
+    EXPECT_EQ( action.executeTick(), BT::NodeStatus::SUCCESS );
+    EXPECT_EQ( action.steps, 3 );
+    EXPECT_EQ( action.destroyed_frames, 1 );
+
+    // start again, then halt
+    EXPECT_EQ( action.executeTick(), BT::NodeStatus::RUNNING );
+    EXPECT_EQ( action.steps, 4 );
+    action.halt();
+    EXPECT_EQ( action.destroyed_frames, 2 );
+
+    // destroyed while RUNNING
+    {
+        auto other = std::make_unique<StacklessAction>("other", config);
+        EXPECT_EQ( other->executeTick(), BT::NodeStatus::RUNNING );
+    }
+}
+
+TEST(CoroTest, stackless_frame_pool)
+{
+    BT::BehaviorTreeFactory factory;
+    factory.registerNodeType<StacklessAction>("StacklessAction");
+    auto tree = factory.createTreeFromText(R"(
+        <root><BehaviorTree><Sequence>
+            <StacklessAction/><StacklessAction/>
+        </Sequence></BehaviorTree></root>)");
+    ASSERT_TRUE( tree.frame_pool );
+
+    EXPECT_EQ( BT::NodeStatus::SUCCESS, executeWhileRunning(*tree.root_node) );
+    // the frame of the first action is reused by the second one
+    EXPECT_EQ( tree.frame_pool->cachedBlocks(), 1 );
+    EXPECT_EQ( BT::NodeStatus::SUCCESS, executeWhileRunning(*tree.root_node) );
+    EXPECT_EQ( tree.frame_pool->cachedBlocks(), 1 );
+}
+#endif
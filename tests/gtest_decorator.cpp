@@ -116,6 +116,24 @@ TEST_F(DeadlineTest, DeadlineNotTriggeredTest)
     ASSERT_EQ(NodeStatus::SUCCESS, state);
 }
 
+TEST_F(DeadlineTest, HaltAndTickAgain)
+{
+    // deadline in 300 ms, action requires 500 ms
+    ASSERT_EQ(NodeStatus::RUNNING, root.executeTick());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // halt() cancels the timer, the next tick starts a new one
+    root.halt();
+    ASSERT_EQ(NodeStatus::IDLE, action.status());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_EQ(NodeStatus::RUNNING, root.executeTick());
+    ASSERT_EQ(NodeStatus::RUNNING, action.status());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    ASSERT_EQ(NodeStatus::FAILURE, root.executeTick());
+    ASSERT_EQ(NodeStatus::IDLE, action.status());
+}
+
 TEST_F(RetryTest, RetryTestA)
 {
     action.setBoolean(false);
@@ -162,3 +180,77 @@ TEST_F(TimeoutAndRetry, Issue57)
         std::this_thread::sleep_for( std::chrono::microseconds(50) );
     }
 }
+
+TEST(TimerServiceTest, AddAndCancel)
+{
+    BT::TimerService service;
+    std::mutex mutex;
+    std::vector<int> fired;
+
+    auto add = [&](int delay_ms, int value)
+    {
+        return service.add(milliseconds(delay_ms), [&fired, &mutex, value]()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            fired.push_back(value);
+        });
+    };
+
+    // many timers, in random order: the handlers are executed by deadline
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 200; i++)
+    {
+        const int value = (i * 37) % 200;
+        ids.push_back( add(20 + value / 4, value) );
+    }
+    // cancel the odd ones
+    for (int i = 0; i < 200; i++)
+    {
+        if( ((i * 37) % 200) % 2 == 1 )
+        {
+            ASSERT_TRUE( service.cancel(ids[i]) );
+            ASSERT_FALSE( service.cancel(ids[i]) );
+        }
+    }
+    ASSERT_EQ( service.size(), 100 );
+
+    std::this_thread::sleep_for( milliseconds(200) );
+    ASSERT_EQ( service.size(), 0 );
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_EQ( fired.size(), 100 );
+        for (size_t i = 0; i < fired.size(); i++)
+        {
+            ASSERT_EQ( fired[i] % 2, 0 );
+            // a few ms of tolerance: the timers are not added at the same time
+            if( i > 0 )
+            {
+                ASSERT_LE( fired[i-1] / 4, fired[i] / 4 + 5 );
+            }
+        }
+    }
+    // an expired timer can't be cancelled, and its ID is not reused
+    ASSERT_FALSE( service.cancel(ids[0]) );
+    const auto new_id = add(1000, -1);
+    for (uint64_t id: ids)
+    {
+        ASSERT_NE( id, new_id );
+    }
+    ASSERT_TRUE( service.cancel(new_id) );
+
+    // cancel() waits for a handler that is running
+    std::atomic<bool> started(false);
+    std::atomic<bool> done(false);
+    const auto slow_id = service.add(milliseconds(0), [&started, &done]()
+    {
+        started = true;
+        std::this_thread::sleep_for( milliseconds(50) );
+        done = true;
+    });
+    while( !started )
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_FALSE( service.cancel(slow_id) );
+    ASSERT_TRUE( done );
+}
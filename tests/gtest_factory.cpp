@@ -5,6 +5,10 @@
 #include "../sample_nodes/crossdoor_nodes.h"
 #include "../sample_nodes/dummy_nodes.h"
 
+#include <fstream>
+#include <set>
+#include <thread>
+
 using namespace BT;
 
 // clang-format off
@@ -244,3 +248,791 @@ TEST(BehaviorTreeFactory, SubTreeWithRemapping)
     ASSERT_FALSE( talk_bb->getAny("talk_out") );
 }
 
+TEST(BehaviorTreeFactory, NodeArena)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<DummyNodes::SaySomething>("SaySomething");
+    factory.enableNodeArena(true);
+
+    Tree tree = factory.createTreeFromText(xml_ports_subtree);
+    ASSERT_TRUE( tree.arena != nullptr );
+    ASSERT_EQ( tree.arena->blocksCount(), 1 );
+
+    tree.root_node->executeTick();
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("talk_out"), "done!");
+
+    // the arena is kept alive by the nodes that outlive the Tree
+    TreeNode::Ptr node = tree.nodes.back();
+    tree = Tree();
+    ASSERT_EQ( node->name(), "SaySomething");
+    node.reset();
+
+    // nodes registered with a custom NodeBuilder are still allocated separately
+    CrossDoor::RegisterNodes(factory);
+    Tree tree_doors = factory.createTreeFromText(xml_text_subtree);
+    ASSERT_TRUE( tree_doors.arena != nullptr );
+    ASSERT_NE( tree_doors.root_node->executeTick(), NodeStatus::IDLE );
+}
+
+TEST(BehaviorTreeFactory, SkipXMLVerification)
+{
+    // a Sequence without children is rejected only by VerifyXML
+    const std::string xml_empty_sequence = R"(
+<root>
+    <BehaviorTree>
+        <Sequence>
+        </Sequence>
+    </BehaviorTree>
+</root> )";
+
+    BehaviorTreeFactory factory;
+    ASSERT_TRUE( factory.xmlVerificationEnabled() );
+    EXPECT_THROW( factory.createTreeFromText(xml_empty_sequence), RuntimeError );
+
+    factory.enableXMLVerification(false);
+    EXPECT_NO_THROW( factory.createTreeFromText(xml_empty_sequence) );
+
+    // the verified and the unverified trees are the same
+    factory.registerNodeType<DummyNodes::SaySomething>("SaySomething");
+    Tree tree = factory.createTreeFromText(xml_ports_subtree);
+    factory.enableXMLVerification(true);
+    Tree verified_tree = factory.createTreeFromText(xml_ports_subtree);
+    ASSERT_EQ( tree.nodes.size(), verified_tree.nodes.size() );
+
+    tree.root_node->executeTick();
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("talk_out"), "done!");
+}
+
+TEST(BehaviorTreeFactory, TreeBlueprint)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<DummyNodes::SaySomething>("SaySomething");
+
+    TreeBlueprint blueprint = factory.createBlueprintFromText(xml_ports_subtree);
+    Tree reference_tree = factory.createTreeFromText(xml_ports_subtree);
+    ASSERT_EQ( blueprint.nodesCount(), reference_tree.nodes.size() );
+    ASSERT_EQ( blueprint.blackboardsCount(), reference_tree.blackboard_stack.size() );
+
+    // the blueprint doesn't depend on the factory
+    factory.unregisterBuilder("SaySomething");
+
+    Tree tree_A = blueprint.instantiate();
+    Tree tree_B = blueprint.instantiate();
+    ASSERT_EQ( tree_A.manifests.size(), reference_tree.manifests.size() );
+
+    for (size_t i = 0; i < reference_tree.nodes.size(); i++)
+    {
+        ASSERT_EQ( tree_A.nodes[i]->name(), reference_tree.nodes[i]->name() );
+        ASSERT_EQ( tree_A.nodes[i]->registrationName(), reference_tree.nodes[i]->registrationName() );
+        ASSERT_NE( tree_A.nodes[i], tree_B.nodes[i] );
+    }
+
+    // each Tree has its own Blackboards
+    ASSERT_EQ( tree_A.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_EQ( tree_A.rootBlackboard()->get<std::string>("talk_out"), "done!");
+    ASSERT_EQ( tree_B.rootBlackboard()->getAny("talk_out")->empty(), true );
+
+    ASSERT_EQ( tree_B.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_EQ( tree_B.rootBlackboard()->get<std::string>("talk_out"), "done!");
+}
+
+TEST(BehaviorTreeFactory, BinaryBlueprint)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<DummyNodes::SaySomething>("SaySomething");
+
+    const auto buffer = factory.createBlueprintFromText(xml_ports_subtree).serialize();
+
+    const char* filename = "gtest_blueprint.btb";
+    {
+        FILE* file = fopen(filename, "wb");
+        ASSERT_TRUE( file != nullptr );
+        fwrite(buffer.data(), 1, buffer.size(), file);
+        fclose(file);
+    }
+    Tree tree = factory.createTreeFromBinaryFile(filename);
+    std::remove(filename);
+
+    Tree reference_tree = factory.createTreeFromText(xml_ports_subtree);
+    ASSERT_EQ( tree.nodes.size(), reference_tree.nodes.size() );
+    ASSERT_EQ( tree.blackboard_stack.size(), reference_tree.blackboard_stack.size() );
+    for (size_t i = 0; i < reference_tree.nodes.size(); i++)
+    {
+        ASSERT_EQ( tree.nodes[i]->name(), reference_tree.nodes[i]->name() );
+        ASSERT_EQ( tree.nodes[i]->registrationName(), reference_tree.nodes[i]->registrationName() );
+    }
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("talk_out"), "done!");
+
+    // corrupted data
+    std::vector<uint8_t> corrupted( buffer.begin(), buffer.begin() + buffer.size() / 2 );
+    EXPECT_THROW( factory.createBlueprintFromBinary( corrupted.data(), corrupted.size() ), RuntimeError );
+
+    // the builders are taken from the factory
+    BehaviorTreeFactory other_factory;
+    EXPECT_THROW( other_factory.createBlueprintFromBinary( buffer.data(), buffer.size() ), RuntimeError );
+}
+
+// Action with a slow constructor, that records the threads that created it
+class SlowConstructorAction : public SyncActionNode
+{
+  public:
+    SlowConstructorAction(const std::string& name, const NodeConfiguration& config)
+      : SyncActionNode(name, config)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::lock_guard<std::mutex> lock(mutex());
+        threads().insert(std::this_thread::get_id());
+    }
+
+    NodeStatus tick() override
+    {
+        setOutput("output", name());
+        return NodeStatus::SUCCESS;
+    }
+
+    static PortsList providedPorts()
+    {
+        return { OutputPort<std::string>("output") };
+    }
+
+    static std::mutex& mutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    static std::set<std::thread::id>& threads()
+    {
+        static std::set<std::thread::id> ids;
+        return ids;
+    }
+};
+
+TEST(BehaviorTreeFactory, ParallelInstantiation)
+{
+    std::string xml = "<root main_tree_to_execute=\"MainTree\">";
+    for (int i = 0; i < 8; i++)
+    {
+        const std::string ID = "Sub" + std::to_string(i);
+        xml += "<BehaviorTree ID=\"" + ID + "\"><Sequence>"
+               "<Slow name=\"" + ID + "_A\" output=\"{out_A}\"/>"
+               "<Slow name=\"" + ID + "_B\" output=\"{out_B}\"/>"
+               "</Sequence></BehaviorTree>";
+    }
+    xml += "<BehaviorTree ID=\"MainTree\"><Sequence>";
+    for (int i = 0; i < 8; i++)
+    {
+        xml += "<SubTree ID=\"Sub" + std::to_string(i) + "\" out_B=\"last\"/>";
+    }
+    xml += "</Sequence></BehaviorTree></root>";
+
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SlowConstructorAction>("Slow");
+    auto blueprint = factory.createBlueprintFromText(xml);
+    Tree serial_tree = blueprint.instantiate();
+
+    SlowConstructorAction::threads().clear();
+    factory.setInstantiationThreads(4);
+    Tree tree = factory.createTreeFromText(xml);
+    ASSERT_GT( SlowConstructorAction::threads().size(), 1 );
+
+    // same order, same relative UIDs, same children
+    ASSERT_EQ( tree.nodes.size(), serial_tree.nodes.size() );
+    ASSERT_EQ( tree.blackboard_stack.size(), serial_tree.blackboard_stack.size() );
+    for (size_t i = 0; i < tree.nodes.size(); i++)
+    {
+        ASSERT_EQ( tree.nodes[i]->name(), serial_tree.nodes[i]->name() );
+        ASSERT_EQ( tree.nodes[i]->UID() - tree.nodes[0]->UID(), int(i) );
+        ASSERT_EQ( serial_tree.nodes[i]->UID() - serial_tree.nodes[0]->UID(), int(i) );
+    }
+
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("last"), "Sub7_B" );
+}
+
+static const char* xml_lazy_subtrees = R"(
+<root main_tree_to_execute = "MainTree" >
+    <BehaviorTree ID="Inner">
+        <Slow name="inner" output="{out}"/>
+    </BehaviorTree>
+    <BehaviorTree ID="Outer">
+        <Sequence>
+            <Slow name="outer" output="{out}"/>
+            <SubTree ID="Inner" out="inner_out"/>
+        </Sequence>
+    </BehaviorTree>
+    <BehaviorTree ID="MainTree">
+        <Sequence>
+            <SubTree ID="Outer" out="outer_out" inner_out="inner_out"/>
+        </Sequence>
+    </BehaviorTree>
+</root>  )";
+
+TEST(BehaviorTreeFactory, LazySubtrees)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SlowConstructorAction>("Slow");
+
+    Tree eager_tree = factory.createTreeFromText(xml_lazy_subtrees);
+    ASSERT_EQ( eager_tree.nodes.size(), 6 );
+
+    factory.enableLazySubtrees(true);
+    Tree tree = factory.createTreeFromText(xml_lazy_subtrees);
+    ASSERT_EQ( tree.nodes.size(), 2 );
+    ASSERT_EQ( tree.blackboard_stack.size(), 1 );
+    ASSERT_EQ( tree.subtree_eviction, nullptr );
+
+    auto outer = dynamic_cast<DecoratorSubtreeNode*>( tree.nodes[1].get() );
+    ASSERT_TRUE( outer && outer->isLazy() );
+    ASSERT_FALSE( outer->isInstantiated() );
+
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_TRUE( outer->isInstantiated() );
+    ASSERT_EQ( outer->lazyNodes().size(), 3 );
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("outer_out"), "outer" );
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("inner_out"), "inner" );
+    ASSERT_EQ( tree.evictIdleSubtrees(), 0 );
+}
+
+TEST(BehaviorTreeFactory, LazySubtreesEviction)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SlowConstructorAction>("Slow");
+    factory.enableLazySubtrees(true, std::chrono::milliseconds(10));
+
+    Tree tree = factory.createTreeFromText(xml_lazy_subtrees);
+    ASSERT_NE( tree.subtree_eviction, nullptr );
+    auto outer = dynamic_cast<DecoratorSubtreeNode*>( tree.nodes[1].get() );
+
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_EQ( tree.subtree_eviction->instantiatedCount(), 2 );
+
+    std::vector<uint16_t> uids;
+    for (const auto& node: outer->lazyNodes())
+    {
+        uids.push_back( node->UID() );
+    }
+    ASSERT_EQ( uids[0], tree.nodes[1]->UID() + 1 );
+
+    // not idle yet
+    ASSERT_EQ( tree.evictIdleSubtrees(), 0 );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds(30) );
+    // the nested SubTree is released together with its parent
+    ASSERT_EQ( tree.evictIdleSubtrees(), 1 );
+    ASSERT_EQ( tree.subtree_eviction->instantiatedCount(), 0 );
+    ASSERT_FALSE( outer->isInstantiated() );
+
+    // created again by the next tick
+    tree.rootBlackboard()->set("outer_out", std::string());
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    ASSERT_TRUE( outer->isInstantiated() );
+    ASSERT_EQ( tree.subtree_eviction->instantiatedCount(), 2 );
+    ASSERT_EQ( tree.rootBlackboard()->get<std::string>("outer_out"), "outer" );
+
+    // the rebuilt nodes get the same UIDs
+    ASSERT_EQ( outer->lazyNodes().size(), uids.size() );
+    for (size_t i = 0; i < uids.size(); i++)
+    {
+        ASSERT_EQ( outer->lazyNodes()[i]->UID(), uids[i] );
+    }
+}
+
+TEST(BehaviorTreeFactory, XMLDocumentCache)
+{
+    const std::string dir = ::testing::TempDir();
+    auto writeFile = [&](const std::string& name, const std::string& text)
+    {
+        std::ofstream file(dir + name);
+        file << text;
+    };
+
+    // diamond: main includes left and right, that include both common
+    writeFile("bt_cache_common.xml", R"(
+<root>
+    <BehaviorTree ID="Common">
+        <AlwaysSuccess/>
+    </BehaviorTree>
+</root>)");
+    writeFile("bt_cache_left.xml", R"(
+<root>
+    <include path="bt_cache_common.xml"/>
+    <BehaviorTree ID="Left">
+        <SubTree ID="Common"/>
+    </BehaviorTree>
+</root>)");
+    writeFile("bt_cache_right.xml", R"(
+<root>
+    <include path="bt_cache_common.xml"/>
+    <BehaviorTree ID="Right">
+        <SubTree ID="Common"/>
+    </BehaviorTree>
+</root>)");
+    writeFile("bt_cache_main.xml", R"(
+<root main_tree_to_execute = "MainTree" >
+    <include path="bt_cache_left.xml"/>
+    <include path="bt_cache_right.xml"/>
+    <BehaviorTree ID="MainTree">
+        <Sequence>
+            <SubTree ID="Left"/>
+            <SubTree ID="Right"/>
+        </Sequence>
+    </BehaviorTree>
+</root>)");
+
+    BehaviorTreeFactory factory;
+    auto cache = std::make_shared<XMLDocumentCache>();
+    factory.setXMLDocumentCache(cache);
+
+    const std::string main_file = dir + "bt_cache_main.xml";
+    {
+        Tree tree = factory.createTreeFromFile(main_file);
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    }
+    ASSERT_EQ( cache->parsedCount(), 4 );
+    ASSERT_EQ( cache->size(), 4 );
+
+    // shared by other factories
+    BehaviorTreeFactory other_factory;
+    other_factory.setXMLDocumentCache(cache);
+    {
+        Tree tree = other_factory.createTreeFromFile(main_file);
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+    }
+    ASSERT_EQ( cache->parsedCount(), 4 );
+
+    // a modified file is parsed again
+    writeFile("bt_cache_common.xml", R"(
+<root>
+    <BehaviorTree ID="Common">
+        <AlwaysFailure/>
+    </BehaviorTree>
+</root>)");
+    {
+        Tree tree = factory.createTreeFromFile(main_file);
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::FAILURE );
+    }
+    ASSERT_EQ( cache->parsedCount(), 5 );
+    ASSERT_EQ( cache->size(), 4 );
+
+    for (const char* name: {"bt_cache_common.xml", "bt_cache_left.xml",
+                            "bt_cache_right.xml", "bt_cache_main.xml"})
+    {
+        std::remove( (dir + name).c_str() );
+    }
+}
+
+TEST(BehaviorTreeFactory, Registration)
+{
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SlowConstructorAction>("Slow");
+    factory.registerSimpleCondition("Check", [](TreeNode&) { return NodeStatus::SUCCESS; },
+                                    { InputPort<int>("b"), InputPort<int>("a") });
+
+    const TreeNodeRegistration* slow = factory.registration("Slow");
+    ASSERT_NE( slow, nullptr );
+    ASSERT_EQ( slow->manifest.type, NodeType::ACTION );
+    ASSERT_TRUE( bool(slow->builder) );
+    ASSERT_TRUE( bool(slow->arena_builder) );
+
+    const TreeNodeRegistration* check = factory.registration("Check");
+    ASSERT_FALSE( bool(check->arena_builder) );
+    ASSERT_EQ( check->ports.size(), 2 );
+    ASSERT_EQ( check->ports[0].name, "a" );
+    ASSERT_EQ( check->findPort("b")->info.direction(), PortDirection::INPUT );
+    ASSERT_EQ( check->findPort("c"), nullptr );
+
+    // a port that is not in the manifest
+    EXPECT_THROW( factory.createTreeFromText(R"(
+<root main_tree_to_execute = "MainTree" >
+    <BehaviorTree ID="MainTree">
+        <Check a="1" c="2"/>
+    </BehaviorTree>
+</root>)"), RuntimeError );
+
+    factory.unregisterBuilder("Check");
+    ASSERT_EQ( factory.registration("Check"), nullptr );
+
+    // a builder that fails before constructing the node
+    factory.registerBuilder<AlwaysSuccessNode>("Broken",
+        [](const std::string&, const NodeConfiguration&) -> std::unique_ptr<TreeNode>
+        {
+            throw RuntimeError("broken builder");
+        });
+    EXPECT_THROW( factory.createTreeFromText(R"(
+<root main_tree_to_execute = "MainTree" >
+    <BehaviorTree ID="MainTree">
+        <Sequence> <Broken/> <AlwaysSuccess/> </Sequence>
+    </BehaviorTree>
+</root>)"), RuntimeError );
+    // the UID reserved for it is not given to the next node of this thread
+    AlwaysSuccessNode first("first");
+    AlwaysSuccessNode second("second");
+    ASSERT_EQ( second.UID(), static_cast<uint16_t>(first.UID() + 1) );
+}
+
+#ifdef BT_TEST_PLUGIN_PATH
+TEST(BehaviorTreeFactory, PluginManifest)
+{
+    // what bt3_plugin_manifest writes
+    std::string manifest_xml;
+    {
+        BehaviorTreeFactory factory;
+        factory.registerFromPlugin(BT_TEST_PLUGIN_PATH);
+        manifest_xml = writePluginManifestXML(factory, BT_TEST_PLUGIN_PATH);
+    }
+    const PluginManifest manifest = readPluginManifestXML(manifest_xml);
+    ASSERT_EQ( manifest.plugin_path, BT_TEST_PLUGIN_PATH );
+    ASSERT_EQ( manifest.nodes.size(), 5 );
+
+    const std::string manifest_file = ::testing::TempDir() + "bt_plugin_manifest.xml";
+    {
+        std::ofstream file(manifest_file);
+        file << manifest_xml;
+    }
+
+    BehaviorTreeFactory factory;
+    factory.registerFromPluginManifest(manifest_file);
+    const auto& say_something = factory.manifests().at("SaySomething");
+    ASSERT_EQ( say_something.type, NodeType::ACTION );
+    ASSERT_EQ( say_something.ports.at("message").direction(), PortDirection::INPUT );
+
+    Tree tree = factory.createTreeFromText(R"(
+<root main_tree_to_execute = "MainTree" >
+    <BehaviorTree ID="MainTree">
+        <Sequence>
+            <CheckBattery/>
+            <SaySomething message="hello"/>
+        </Sequence>
+    </BehaviorTree>
+</root>)");
+    ASSERT_EQ( tree.nodes[2]->registrationName(), "SaySomething" );
+    ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+
+    // the error is detected when the plugin is loaded
+    const std::string wrong_manifest_file = ::testing::TempDir() + "bt_wrong_plugin_manifest.xml";
+    {
+        std::ofstream file(wrong_manifest_file);
+        const auto pos = manifest_xml.find("</TreeNodesModel>");
+        file << manifest_xml.substr(0, pos) << "<Action ID=\"NotInPlugin\"/>"
+             << manifest_xml.substr(pos);
+    }
+    BehaviorTreeFactory other_factory;
+    other_factory.registerFromPluginManifest(wrong_manifest_file);
+    EXPECT_THROW( other_factory.createTreeFromText(R"(
+<root main_tree_to_execute = "MainTree" >
+    <BehaviorTree ID="MainTree">
+        <NotInPlugin/>
+    </BehaviorTree>
+</root>)"), RuntimeError );
+}
+#endif
+
+class SleepAsyncAction: public AsyncActionNode
+{
+  public:
+    SleepAsyncAction(const std::string& name, const NodeConfiguration& config):
+      AsyncActionNode(name, config),
+      halted_(false)
+    {}
+
+    ~SleepAsyncAction() override
+    {
+        stopAndJoinThread();
+    }
+
+    NodeStatus tick() override
+    {
+        {
+            std::unique_lock<std::mutex> lock(threads_mutex);
+            threads.insert( std::this_thread::get_id() );
+        }
+        auto must_throw = getInput<bool>("throw");
+        if( must_throw && must_throw.value() )
+        {
+            throw RuntimeError("SleepAsyncAction failed");
+        }
+        halted_ = false;
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds( getInput<int>("msec").value() );
+        while( !halted_ && std::chrono::steady_clock::now() < deadline )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds(1) );
+        }
+        return halted_ ? NodeStatus::IDLE : NodeStatus::SUCCESS;
+    }
+
+    void halt() override
+    {
+        halted_ = true;
+    }
+
+    static PortsList providedPorts()
+    {
+        return { InputPort<int>("msec"), InputPort<bool>("throw") };
+    }
+
+    static std::mutex threads_mutex;
+    static std::set<std::thread::id> threads;
+
+  private:
+    std::atomic_bool halted_;
+};
+
+std::mutex SleepAsyncAction::threads_mutex;
+std::set<std::thread::id> SleepAsyncAction::threads;
+
+TEST(BehaviorTreeFactory, AsyncExecutor)
+{
+    auto executor = std::make_shared<ThreadPool>(2);
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SleepAsyncAction>("SleepAsyncAction");
+    factory.setAsyncExecutor(executor);
+
+    auto tickUntilDone = [](Tree& tree)
+    {
+        NodeStatus status = tree.root_node->executeTick();
+        while( status == NodeStatus::RUNNING )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds(1) );
+            status = tree.root_node->executeTick();
+        }
+        return status;
+    };
+
+    std::string xml_parallel = R"(<root><BehaviorTree><Parallel threshold="8">)";
+    for (int i = 0; i < 8; i++)
+    {
+        xml_parallel += R"(<SleepAsyncAction msec="5"/>)";
+    }
+    xml_parallel += R"(</Parallel></BehaviorTree></root>)";
+
+    SleepAsyncAction::threads.clear();
+    {
+        auto tree = factory.createTreeFromText(xml_parallel);
+        ASSERT_EQ( tickUntilDone(tree), NodeStatus::SUCCESS );
+        haltAllActions(tree.root_node);
+        ASSERT_EQ( tickUntilDone(tree), NodeStatus::SUCCESS );
+    }
+    // 8 nodes, 2 threads
+    ASSERT_EQ( executor->threadsCount(), 2 );
+    ASSERT_EQ( SleepAsyncAction::threads.size(), 2 );
+    ASSERT_EQ( SleepAsyncAction::threads.count( std::this_thread::get_id() ), 0 );
+
+    // halt a node that is running
+    {
+        auto tree = factory.createTreeFromText(
+            R"(<root><BehaviorTree><SleepAsyncAction msec="10000"/></BehaviorTree></root>)");
+        const auto start = std::chrono::steady_clock::now();
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::RUNNING );
+        std::this_thread::sleep_for( std::chrono::milliseconds(5) );
+        haltAllActions(tree.root_node);
+        ASSERT_LT( std::chrono::steady_clock::now() - start, std::chrono::seconds(5) );
+    }
+
+    // halt a node and start it again, while the previous tick() is still running
+    {
+        auto tree = factory.createTreeFromText(
+            R"(<root><BehaviorTree><SleepAsyncAction msec="50"/></BehaviorTree></root>)");
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::RUNNING );
+        tree.root_node->halt();
+        tree.root_node->setStatus( NodeStatus::IDLE );
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::RUNNING );
+        // the result of the halted tick() must not overwrite RUNNING
+        std::this_thread::sleep_for( std::chrono::milliseconds(20) );
+        ASSERT_EQ( tree.root_node->status(), NodeStatus::RUNNING );
+        ASSERT_EQ( tickUntilDone(tree), NodeStatus::SUCCESS );
+    }
+
+    // the exceptions are rethrown by executeTick()
+    {
+        auto tree = factory.createTreeFromText(
+            R"(<root><BehaviorTree><SleepAsyncAction msec="1" throw="true"/></BehaviorTree></root>)");
+        ASSERT_THROW( tickUntilDone(tree), RuntimeError );
+        ASSERT_THROW( tree.root_node->executeTick(), RuntimeError );
+    }
+    ASSERT_EQ( executor.use_count(), 2 );
+}
+
+// RUNNING until the entry "flag" is true or, if "msec" is given, until the
+// delay expires.
+class WaitEventAction: public StatefulActionNode
+{
+  public:
+    WaitEventAction(const std::string& name, const NodeConfiguration& config):
+      StatefulActionNode(name, config)
+    {}
+
+    NodeStatus onStart() override
+    {
+        start_ = std::chrono::steady_clock::now();
+        return onRunning();
+    }
+
+    NodeStatus onRunning() override
+    {
+        auto flag = getInput<bool>("flag");
+        if( flag && flag.value() )
+        {
+            return NodeStatus::SUCCESS;
+        }
+        auto msec = getInput<int>("msec");
+        if( msec )
+        {
+            const auto deadline = start_ + std::chrono::milliseconds( msec.value() );
+            const auto now = std::chrono::steady_clock::now();
+            if( now >= deadline )
+            {
+                return NodeStatus::SUCCESS;
+            }
+            requestWakeUp( deadline - now );
+        }
+        return NodeStatus::RUNNING;
+    }
+
+    void onHalted() override
+    {}
+
+    static PortsList providedPorts()
+    {
+        return { InputPort<bool>("flag"), InputPort<int>("msec") };
+    }
+
+  private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+TEST(BehaviorTreeFactory, TickWhileRunning)
+{
+    using Clock = std::chrono::steady_clock;
+    // longer than any test: the tree must be woken up by the events
+    const auto max_sleep = std::chrono::milliseconds(10000);
+    const auto max_duration = std::chrono::milliseconds(2000);
+
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<SleepAsyncAction>("SleepAsyncAction");
+    factory.registerNodeType<WaitEventAction>("WaitEventAction");
+    int ticks = 0;
+    factory.registerSimpleCondition("CountTicks", [&ticks](TreeNode&)
+    {
+        ticks++;
+        return NodeStatus::SUCCESS;
+    });
+
+    // an AsyncActionNode wakes up the tree when tick() returns
+    {
+        auto tree = factory.createTreeFromText(R"(
+            <root><BehaviorTree><ReactiveSequence>
+                <CountTicks/><SleepAsyncAction msec="20"/>
+            </ReactiveSequence></BehaviorTree></root>)");
+        ticks = 0;
+        const auto start = Clock::now();
+        ASSERT_EQ( tree.tickWhileRunning(max_sleep), NodeStatus::SUCCESS );
+        ASSERT_LT( Clock::now() - start, max_duration );
+        ASSERT_EQ( ticks, 2 );
+    }
+
+    // the same with the executor
+    factory.setAsyncExecutor( std::make_shared<ThreadPool>(1) );
+    {
+        auto tree = factory.createTreeFromText(R"(
+            <root><BehaviorTree><SleepAsyncAction msec="20"/></BehaviorTree></root>)");
+        const auto start = Clock::now();
+        ASSERT_EQ( tree.tickWhileRunning(max_sleep), NodeStatus::SUCCESS );
+        ASSERT_LT( Clock::now() - start, max_duration );
+    }
+
+    // a watched entry of the Blackboard is written by another thread
+    {
+        auto tree = factory.createTreeFromText(R"(
+            <root><BehaviorTree><ReactiveSequence>
+                <CountTicks/><WaitEventAction flag="{flag}"/>
+            </ReactiveSequence></BehaviorTree></root>)");
+        tree.rootBlackboard()->set("flag", false);
+        tree.watchBlackboardEntry("flag");
+        ticks = 0;
+        std::thread writer([&tree]()
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds(20) );
+            tree.rootBlackboard()->set("flag", true);
+        });
+        const auto start = Clock::now();
+        const auto status = tree.tickWhileRunning(max_sleep);
+        writer.join();
+        ASSERT_EQ( status, NodeStatus::SUCCESS );
+        ASSERT_LT( Clock::now() - start, max_duration );
+        ASSERT_EQ( ticks, 2 );
+    }
+
+    // a node requests to be ticked again after a delay
+    {
+        auto tree = factory.createTreeFromText(R"(
+            <root><BehaviorTree><WaitEventAction msec="20"/></BehaviorTree></root>)");
+        const auto start = Clock::now();
+        ASSERT_EQ( tree.tickWhileRunning(max_sleep), NodeStatus::SUCCESS );
+        const auto elapsed = Clock::now() - start;
+        ASSERT_GE( elapsed, std::chrono::milliseconds(20) );
+        ASSERT_LT( elapsed, max_duration );
+    }
+
+    // without events, sleep() waits for the timeout
+    {
+        auto tree = factory.createTreeFromText(R"(
+            <root><BehaviorTree><WaitEventAction/></BehaviorTree></root>)");
+        ASSERT_FALSE( tree.sleep( std::chrono::milliseconds(5) ) );
+        tree.wake_up->emitSignal();
+        ASSERT_TRUE( tree.sleep( max_sleep ) );
+    }
+}
+
+// Without ports, but with both constructors
+class TwoConstructorsAction: public SyncActionNode
+{
+  public:
+    TwoConstructorsAction(const std::string& name):
+      SyncActionNode(name, NodeConfiguration())
+    {}
+
+    TwoConstructorsAction(const std::string& name, const NodeConfiguration& config):
+      SyncActionNode(name, config)
+    {}
+
+    NodeStatus tick() override
+    {
+        emitWakeUpSignal();
+        return NodeStatus::SUCCESS;
+    }
+
+    static PortsList providedPorts()
+    {
+        return {};
+    }
+};
+
+TEST(BehaviorTreeFactory, ConstructorWithoutPorts)
+{
+    auto executor = std::make_shared<ThreadPool>(1);
+    BehaviorTreeFactory factory;
+    factory.registerNodeType<TwoConstructorsAction>("TwoConstructorsAction");
+    factory.setAsyncExecutor(executor);
+
+    const std::string xml_text = R"(
+        <root><BehaviorTree><TwoConstructorsAction/></BehaviorTree></root>)";
+
+    for (bool arena : {false, true})
+    {
+        factory.enableNodeArena(arena);
+        auto tree = factory.createTreeFromText(xml_text);
+        ASSERT_EQ( tree.arena != nullptr, arena );
+
+        // the NodeConfiguration is not discarded
+        const NodeConfiguration& config = tree.root_node->config();
+        ASSERT_EQ( config.async_executor, executor );
+        ASSERT_TRUE( config.wake_up != nullptr );
+        ASSERT_EQ( config.wake_up, tree.wake_up );
+
+        ASSERT_EQ( tree.root_node->executeTick(), NodeStatus::SUCCESS );
+        ASSERT_TRUE( tree.sleep( std::chrono::milliseconds(0) ) );
+    }
+}
@@ -77,6 +77,33 @@ TEST_F(BehaviorTreeTest, Condition2ToFalseCondition1True)
     ASSERT_EQ(NodeStatus::RUNNING, action_1.status());
 }
 
+TEST(BehaviorTreeStatusChange, SubscribeAndUnsubscribe)
+{
+    BT::AlwaysSuccessNode node("node");
+    int count = 0;
+    auto callback = [&count](BT::TimePoint, const BT::TreeNode&, NodeStatus, NodeStatus) {
+        count++;
+    };
+
+    node.executeTick();
+    node.setStatus(NodeStatus::IDLE);
+    ASSERT_EQ(0, count);
+
+    auto subscriber = node.subscribeToStatusChange(callback);
+    node.executeTick();
+    node.setStatus(NodeStatus::IDLE);
+    ASSERT_EQ(2, count);
+
+    subscriber.reset();
+    node.executeTick();
+    node.setStatus(NodeStatus::IDLE);
+    ASSERT_EQ(2, count);
+
+    subscriber = node.subscribeToStatusChange(callback);
+    node.executeTick();
+    ASSERT_EQ(3, count);
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
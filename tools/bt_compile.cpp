@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "behaviortree_cpp_v3/bt_factory.h"
+
+// Compile an XML file into the binary format loaded by
+// BehaviorTreeFactory::createBlueprintFromBinaryFile()
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> plugins;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--plugin") == 0 && i + 1 < argc)
+        {
+            plugins.emplace_back(argv[++i]);
+        }
+        else
+        {
+            files.emplace_back(argv[i]);
+        }
+    }
+
+    if (files.size() != 2)
+    {
+        printf("Wrong number of command line arguments\n"
+               "Usage: %s [--plugin library]... [input.xml] [output.btb]\n", argv[0]);
+        return 1;
+    }
+
+    BT::BehaviorTreeFactory factory;
+    for (const auto& plugin : plugins)
+    {
+        factory.registerFromPlugin(plugin);
+    }
+
+    try
+    {
+        const auto blueprint = factory.createBlueprintFromFile(files[0]);
+        const auto buffer = blueprint.serialize();
+
+        FILE* file = fopen(files[1].c_str(), "wb");
+        if (!file)
+        {
+            printf("Failed to open file: [%s]\n", files[1].c_str());
+            return 1;
+        }
+        const size_t written = fwrite(buffer.data(), 1, buffer.size(), file);
+        fclose(file);
+        if (written != buffer.size())
+        {
+            printf("Failed to write file: [%s]\n", files[1].c_str());
+            return 1;
+        }
+        printf("%s: %d nodes, %d bytes\n", files[1].c_str(),
+               int(blueprint.nodesCount()), int(buffer.size()));
+    }
+    catch (std::exception& err)
+    {
+        printf("Failed to compile [%s]: %s\n", files[0].c_str(), err.what());
+        return 1;
+    }
+    return 0;
+}
@@ -3,12 +3,16 @@
 #include <fstream>
 #include <unordered_map>
 #include "behaviortree_cpp_v3/bt_factory.h"
+#include "behaviortree_cpp_v3/xml_parsing.h"
+#include "filesystem/path.h"
 
 int main(int argc, char* argv[])
 {
-    if (argc != 2)
+    if (argc != 2 && argc != 3)
     {
-        printf("Wrong number of command line arguments\nUsage: %s [filename]\n", argv[0]);
+        printf("Wrong number of command line arguments\nUsage: %s [filename] [manifest.xml]\n"
+               "If [manifest.xml] is given, write the manifest used by "
+               "BehaviorTreeFactory::registerFromPluginManifest()\n", argv[0]);
         return 1;
     }
 
@@ -23,6 +27,20 @@ int main(int argc, char* argv[])
 
     factory.registerFromPlugin(argv[1]);
 
+    if (argc == 3)
+    {
+        // the manifest can be moved: the plugin is identified by its absolute path
+        const std::string plugin_path = filesystem::path(argv[1]).make_absolute().str();
+        std::ofstream file(argv[2]);
+        file << BT::writePluginManifestXML(factory, plugin_path);
+        if (!file)
+        {
+            printf("Can't write the file %s\n", argv[2]);
+            return 1;
+        }
+        return 0;
+    }
+
     for (auto& it : factory.manifests())
     {
         const auto& manifest = it.second;